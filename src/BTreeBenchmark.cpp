@@ -0,0 +1,102 @@
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "BTreeVector.h"
+#include "BenchmarkUtils.h"
+#include "Vector.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+
+unsigned nextRandom(unsigned& seed)
+{
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 4;
+}
+
+void perfomTest(std::size_t size, std::size_t operations)
+{
+    aisdi::Vector<int> vector;
+    aisdi::BTreeVector<int> tree;
+    vector.resize(size);
+    for(std::size_t i = 0; i < size; ++i)
+        tree.append(static_cast<int>(i));
+    int* items = vector.data();
+    for(std::size_t i = 0; i < size; ++i)
+        items[i] = static_cast<int>(i);
+
+    unsigned seed = 2016;
+    const double vectorInsertMs = measureMs([&]
+    {
+        for(std::size_t i = 0; i < operations; ++i)
+            vector.insert(vector.begin() + nextRandom(seed) % vector.getSize(), static_cast<int>(i));
+    });
+    seed = 2016;
+    const double treeInsertMs = measureMs([&]
+    {
+        for(std::size_t i = 0; i < operations; ++i)
+            tree.insert(nextRandom(seed) % tree.getSize(), static_cast<int>(i));
+    });
+
+    volatile long sink = 0;
+    long sum = 0;
+    seed = 7;
+    const double vectorIndexMs = measureMs([&]
+    {
+        const int* data = vector.data();
+        for(std::size_t i = 0; i < operations; ++i)
+            sum += data[nextRandom(seed) % vector.getSize()];
+    });
+    seed = 7;
+    const double treeIndexMs = measureMs([&]
+    {
+        for(std::size_t i = 0; i < operations; ++i)
+            sum -= tree.at(nextRandom(seed) % tree.getSize());
+    });
+    if(sum != 0) std::cout << "Results differ!" << std::endl;
+
+    const double vectorScanMs = measureMs([&]
+    {
+        long acc = 0;
+        for(auto it = vector.begin(); it != vector.end(); ++it)
+            acc += *it;
+        sink = acc;
+    });
+    const double treeScanMs = measureMs([&]
+    {
+        long acc = 0;
+        for(auto it = tree.begin(); it != tree.end(); ++it)
+            acc += *it;
+        sink = acc;
+    });
+    const double treeForEachMs = measureMs([&]
+    {
+        long acc = 0;
+        tree.forEach([&acc](int item) { acc += item; });
+        sink = acc;
+    });
+
+    std::cout << size << " ints, " << operations << " operations, tree height " << tree.getHeight() << std::endl
+              << std::fixed << std::setprecision(2)
+              << "random insert:  Vector " << vectorInsertMs << " ms, BTreeVector " << treeInsertMs << " ms" << std::endl
+              << "random index:   Vector " << vectorIndexMs << " ms, BTreeVector " << treeIndexMs << " ms" << std::endl
+              << "iteration:      Vector " << vectorScanMs << " ms, BTreeVector " << treeScanMs << " ms"
+              << " (forEach " << treeForEachMs << " ms)" << std::endl;
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const std::size_t size = argc > 1 ? std::atoll(argv[1]) : 10000000;
+    const std::size_t operations = argc > 2 ? std::atoll(argv[2]) : 200;
+
+    perfomTest(size, operations);
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
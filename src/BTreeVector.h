@@ -0,0 +1,675 @@
+#ifndef AISDI_LINEAR_BTREEVECTOR_H
+#define AISDI_LINEAR_BTREEVECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+
+namespace aisdi
+{
+
+//Sequence stored in a B+tree indexed by position. Every inner node keeps the number of
+//elements under each of its children, so finding, inserting and erasing the element at
+//an index are O(log n) instead of the O(n) shift of Vector or walk of LinkedList.
+//Elements live in leaves of a few cache lines that are linked to their neighbours, so
+//iteration runs through contiguous arrays and only follows a pointer once per leaf.
+template <typename Type>
+class BTreeVector
+{
+public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type*;
+    using reference = Type&;
+    using const_pointer = const Type*;
+    using const_reference = const Type&;
+
+    class ConstIterator;
+    class Iterator;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+    static const size_type LEAF_BYTES = 512; //Eight cache lines of elements per leaf
+    static const size_type LEAF_CAPACITY = LEAF_BYTES / sizeof(Type) >= 8 ? LEAF_BYTES / sizeof(Type) : 8;
+    static const size_type FANOUT = 32; //Children per inner node
+
+private:
+    struct Node
+    {
+        bool leaf;
+        size_type count; //Number of items or children
+
+        explicit Node(bool l) : leaf(l), count(0)
+        {}
+    };
+
+    struct Leaf : Node
+    {
+        Leaf* prev;
+        Leaf* next;
+        value_type items[LEAF_CAPACITY];
+
+        Leaf() : Node(true), prev(nullptr), next(nullptr)
+        {}
+    };
+
+    struct Inner : Node
+    {
+        Node* children[FANOUT];
+        size_type sizes[FANOUT]; //Number of elements under every child
+
+        Inner() : Node(false)
+        {}
+    };
+
+    Node* root; //nullptr for an empty sequence
+    Leaf* head;
+    Leaf* tail;
+    size_type size;
+
+    static Leaf* asLeaf(Node* node)
+    {
+        return static_cast<Leaf*>(node);
+    }
+
+    static Inner* asInner(Node* node)
+    {
+        return static_cast<Inner*>(node);
+    }
+
+    static void destroy(Node* node)
+    {
+        if(!node) return;
+        if(node->leaf)
+        {
+            delete asLeaf(node);
+            return;
+        }
+        Inner* inner = asInner(node);
+        for(size_type i = 0; i < inner->count; ++i)
+            destroy(inner->children[i]);
+        delete inner;
+    }
+
+    static size_type sizeOf(const Node* node)
+    {
+        if(node->leaf) return node->count;
+        const Inner* inner = static_cast<const Inner*>(node);
+        size_type total = 0;
+        for(size_type i = 0; i < inner->count; ++i)
+            total += inner->sizes[i];
+        return total;
+    }
+
+    //Leaf holding the element at *index* < size, and its position there
+    Leaf* locate(size_type index, size_type& offset) const
+    {
+        Node* node = root;
+        while(!node->leaf)
+        {
+            const Inner* inner = asInner(node);
+            size_type i = 0;
+            while(index >= inner->sizes[i])
+                index -= inner->sizes[i++];
+            node = inner->children[i];
+        }
+        offset = index;
+        return asLeaf(node);
+    }
+
+    //Insert *item* before position *index* of the subtree; return the new right sibling
+    //of *node* when it had to be split, nullptr otherwise
+    Node* insertAt(Node* node, size_type index, const value_type& item)
+    {
+        if(node->leaf) return insertIntoLeaf(asLeaf(node), index, item);
+
+        Inner* inner = asInner(node);
+        size_type i = 0;
+        while(i + 1 < inner->count && index > inner->sizes[i])
+            index -= inner->sizes[i++];
+        Node* split = insertAt(inner->children[i], index, item);
+        ++inner->sizes[i];
+        if(!split) return nullptr;
+
+        const size_type splitSize = sizeOf(split);
+        inner->sizes[i] -= splitSize;
+        Inner* target = inner;
+        Inner* right = nullptr;
+        size_type position = i + 1;
+        if(inner->count == FANOUT)
+        {
+            const size_type half = FANOUT / 2;
+            right = new Inner;
+            std::copy(inner->children + half, inner->children + FANOUT, right->children);
+            std::copy(inner->sizes + half, inner->sizes + FANOUT, right->sizes);
+            right->count = FANOUT - half;
+            inner->count = half;
+            if(position > half)
+            {
+                target = right;
+                position -= half;
+            }
+        }
+        std::copy_backward(target->children + position, target->children + target->count,
+                           target->children + target->count + 1);
+        std::copy_backward(target->sizes + position, target->sizes + target->count, target->sizes + target->count + 1);
+        target->children[position] = split;
+        target->sizes[position] = splitSize;
+        ++target->count;
+        return right;
+    }
+
+    Node* insertIntoLeaf(Leaf* leaf, size_type index, const value_type& item)
+    {
+        Leaf* target = leaf;
+        Leaf* right = nullptr;
+        if(leaf->count == LEAF_CAPACITY)
+        {
+            //Appending to the last leaf leaves it full, so a sequence built by append packs tightly
+            const size_type half = index == LEAF_CAPACITY && !leaf->next ? LEAF_CAPACITY : LEAF_CAPACITY / 2;
+            right = new Leaf;
+            std::copy(leaf->items + half, leaf->items + LEAF_CAPACITY, right->items);
+            right->count = LEAF_CAPACITY - half;
+            leaf->count = half;
+            right->prev = leaf;
+            right->next = leaf->next;
+            if(leaf->next) leaf->next->prev = right;
+            else tail = right;
+            leaf->next = right;
+            if(index > half || half == LEAF_CAPACITY)
+            {
+                target = right;
+                index -= half;
+            }
+        }
+        std::copy_backward(target->items + index, target->items + target->count, target->items + target->count + 1);
+        target->items[index] = item;
+        ++target->count;
+        return right;
+    }
+
+    //Remove the element at *index* of the subtree
+    void eraseAt(Node* node, size_type index)
+    {
+        if(node->leaf)
+        {
+            Leaf* leaf = asLeaf(node);
+            std::copy(leaf->items + index + 1, leaf->items + leaf->count, leaf->items + index);
+            --leaf->count;
+            return;
+        }
+        Inner* inner = asInner(node);
+        size_type i = 0;
+        while(index >= inner->sizes[i])
+            index -= inner->sizes[i++];
+        eraseAt(inner->children[i], index);
+        --inner->sizes[i];
+        const Node* child = inner->children[i];
+        if(child->count < (child->leaf ? LEAF_CAPACITY : FANOUT) / 2) rebalance(inner, i);
+    }
+
+    //Merge the underfull child *i* with a neighbour, or even out their contents when both
+    //do not fit in one node
+    void rebalance(Inner* inner, size_type i)
+    {
+        if(inner->count < 2) return;
+        const size_type left = i > 0 ? i - 1 : i;
+        Node* a = inner->children[left];
+        Node* b = inner->children[left + 1];
+        const size_type capacity = a->leaf ? LEAF_CAPACITY : FANOUT;
+        const size_type total = a->count + b->count;
+        const size_type keep = total <= capacity ? total : total / 2; //Entries that end up in *a*
+
+        if(a->leaf) moveLeafItems(asLeaf(a), asLeaf(b), keep);
+        else moveChildren(asInner(a), asInner(b), keep);
+        inner->sizes[left] = sizeOf(a);
+        inner->sizes[left + 1] = sizeOf(b);
+
+        if(b->count == 0)
+        {
+            if(b->leaf)
+            {
+                Leaf* removed = asLeaf(b);
+                asLeaf(a)->next = removed->next;
+                if(removed->next) removed->next->prev = asLeaf(a);
+                else tail = asLeaf(a);
+                delete removed;
+            }
+            else delete asInner(b);
+            std::copy(inner->children + left + 2, inner->children + inner->count, inner->children + left + 1);
+            std::copy(inner->sizes + left + 2, inner->sizes + inner->count, inner->sizes + left + 1);
+            --inner->count;
+        }
+    }
+
+    //Shift entries between adjacent nodes so that *a* holds exactly *keep* of them
+    static void moveLeafItems(Leaf* a, Leaf* b, size_type keep)
+    {
+        if(keep > a->count)
+        {
+            const size_type moved = keep - a->count;
+            std::copy(b->items, b->items + moved, a->items + a->count);
+            std::copy(b->items + moved, b->items + b->count, b->items);
+            b->count -= moved;
+        }
+        else
+        {
+            const size_type moved = a->count - keep;
+            std::copy_backward(b->items, b->items + b->count, b->items + b->count + moved);
+            std::copy(a->items + keep, a->items + a->count, b->items);
+            b->count += moved;
+        }
+        a->count = keep;
+    }
+
+    static void moveChildren(Inner* a, Inner* b, size_type keep)
+    {
+        if(keep > a->count)
+        {
+            const size_type moved = keep - a->count;
+            std::copy(b->children, b->children + moved, a->children + a->count);
+            std::copy(b->sizes, b->sizes + moved, a->sizes + a->count);
+            std::copy(b->children + moved, b->children + b->count, b->children);
+            std::copy(b->sizes + moved, b->sizes + b->count, b->sizes);
+            b->count -= moved;
+        }
+        else
+        {
+            const size_type moved = a->count - keep;
+            std::copy_backward(b->children, b->children + b->count, b->children + b->count + moved);
+            std::copy_backward(b->sizes, b->sizes + b->count, b->sizes + b->count + moved);
+            std::copy(a->children + keep, a->children + a->count, b->children);
+            std::copy(a->sizes + keep, a->sizes + a->count, b->sizes);
+            b->count += moved;
+        }
+        a->count = keep;
+    }
+
+    const_iterator iteratorAt(size_type index) const
+    {
+        if(index >= size) return const_iterator(this, tail, tail ? tail->count : 0, index);
+        size_type offset;
+        const Leaf* leaf = locate(index, offset);
+        return const_iterator(this, leaf, offset, index);
+    }
+
+public:
+    BTreeVector() : root(nullptr), head(nullptr), tail(nullptr), size(0)
+    {}
+
+    BTreeVector(std::initializer_list<Type> l) : BTreeVector()
+    {
+        for(const value_type& item : l)
+            append(item);
+    }
+
+    BTreeVector(const BTreeVector& other) : BTreeVector()
+    {
+        for(const Leaf* leaf = other.head; leaf; leaf = leaf->next)
+            for(size_type i = 0; i < leaf->count; ++i)
+                append(leaf->items[i]);
+    }
+
+    BTreeVector(BTreeVector&& other) : root(other.root), head(other.head), tail(other.tail), size(other.size)
+    {
+        other.root = nullptr;
+        other.head = other.tail = nullptr;
+        other.size = 0;
+    }
+
+    ~BTreeVector()
+    {
+        destroy(root);
+    }
+
+    friend void swap(BTreeVector& first, BTreeVector& second)
+    {
+        using std::swap;
+        swap(first.root, second.root);
+        swap(first.head, second.head);
+        swap(first.tail, second.tail);
+        swap(first.size, second.size);
+    }
+
+    BTreeVector& operator=(BTreeVector other)
+    {
+        swap(*this, other);
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return size == 0;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    //Number of levels, 1 when all elements fit in one leaf
+    size_type getHeight() const
+    {
+        size_type height = 0;
+        for(const Node* node = root; node; node = node->leaf ? nullptr : static_cast<const Inner*>(node)->children[0])
+            ++height;
+        return height;
+    }
+
+    reference at(size_type index)
+    {
+        if(index >= size) throw std::out_of_range("Index out of range");
+        size_type offset;
+        return locate(index, offset)->items[offset];
+    }
+
+    const_reference at(size_type index) const
+    {
+        if(index >= size) throw std::out_of_range("Index out of range");
+        size_type offset;
+        return locate(index, offset)->items[offset];
+    }
+
+    reference operator[](size_type index)
+    {
+        return at(index);
+    }
+
+    const_reference operator[](size_type index) const
+    {
+        return at(index);
+    }
+
+    //Call f(item) for every element in order, one leaf at a time
+    template <typename Function>
+    void forEach(Function f) const
+    {
+        for(const Leaf* leaf = head; leaf; leaf = leaf->next)
+            std::for_each(leaf->items, leaf->items + leaf->count, f);
+    }
+
+    void append(const Type& item)
+    {
+        insert(size, item);
+    }
+
+    void prepend(const Type& item)
+    {
+        insert(0, item);
+    }
+
+    void insert(const const_iterator& insertPosition, const Type& item)
+    {
+        insert(insertPosition.index, item);
+    }
+
+    void insert(size_type index, const Type& item)
+    {
+        if(index > size) throw std::out_of_range("Cannot insert outside of the vector");
+        const value_type copy = item; //*item* may be shifted by the insertion
+        if(!root) root = head = tail = new Leaf;
+        Node* split = insertAt(root, index, copy);
+        if(split)
+        {
+            Inner* newRoot = new Inner;
+            newRoot->children[0] = root;
+            newRoot->children[1] = split;
+            newRoot->sizes[1] = sizeOf(split);
+            newRoot->sizes[0] = size + 1 - newRoot->sizes[1];
+            newRoot->count = 2;
+            root = newRoot;
+        }
+        ++size;
+    }
+
+    value_type popFirst()
+    {
+        if(isEmpty()) throw std::logic_error("Vector is empty");
+        value_type temp = head->items[0];
+        erase(size_type(0));
+        return temp;
+    }
+
+    value_type popLast()
+    {
+        if(isEmpty()) throw std::logic_error("Vector is empty");
+        value_type temp = tail->items[tail->count - 1];
+        erase(size - 1);
+        return temp;
+    }
+
+    void erase(const const_iterator& possition)
+    {
+        erase(possition, possition + 1);
+    }
+
+    void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded)
+    {
+        if(isEmpty()) throw std::out_of_range("Vector is empty");
+        const size_type first = firstIncluded.index;
+        const size_type last = lastExcluded.index;
+        if(last < first || last > size) throw std::out_of_range("firstIncluded should be before lastExcluded");
+        for(size_type i = first; i < last; ++i)
+            erase(first);
+    }
+
+    void erase(size_type index)
+    {
+        if(index >= size) throw std::out_of_range("Index out of range");
+        eraseAt(root, index);
+        --size;
+        while(!root->leaf && root->count == 1)
+        {
+            Inner* old = asInner(root);
+            root = old->children[0];
+            delete old;
+        }
+        if(size == 0)
+        {
+            destroy(root);
+            root = head = tail = nullptr;
+        }
+    }
+
+    iterator begin()
+    {
+        return iterator(cbegin());
+    }
+
+    iterator end()
+    {
+        return iterator(cend());
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(this, head, 0, 0);
+    }
+
+    const_iterator cend() const
+    {
+        return iteratorAt(size);
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+};
+
+template <typename Type>
+const typename BTreeVector<Type>::size_type BTreeVector<Type>::LEAF_BYTES;
+
+template <typename Type>
+const typename BTreeVector<Type>::size_type BTreeVector<Type>::LEAF_CAPACITY;
+
+template <typename Type>
+const typename BTreeVector<Type>::size_type BTreeVector<Type>::FANOUT;
+
+//Remembers its leaf, so stepping is O(1) and only crosses a link at leaf boundaries
+template <typename Type>
+class BTreeVector<Type>::ConstIterator
+{
+public:
+    friend class BTreeVector<Type>;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename BTreeVector::value_type;
+    using difference_type = typename BTreeVector::difference_type;
+    using pointer = typename BTreeVector::const_pointer;
+    using reference = typename BTreeVector::const_reference;
+
+private:
+    const BTreeVector<Type>* parent_vec;
+    const Leaf* leaf;
+    size_type offset; //Position within *leaf*
+    size_type index;
+
+public:
+    explicit ConstIterator() : parent_vec(nullptr), leaf(nullptr), offset(0), index(0)
+    {}
+
+    ConstIterator(const BTreeVector<Type>* parent, const Leaf* l, size_type o, size_type i) : parent_vec(parent),
+                    leaf(l), offset(o), index(i)
+    {}
+
+    reference operator*() const
+    {
+        if(index >= parent_vec->size) throw std::out_of_range("Iterator points at empty space after the last element");
+        return leaf->items[offset];
+    }
+
+    ConstIterator& operator++()
+    {
+        if(index >= parent_vec->size) throw std::out_of_range("Cannot increment iterator");
+        ++index;
+        if(++offset == leaf->count && leaf->next)
+        {
+            leaf = leaf->next;
+            offset = 0;
+        }
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    ConstIterator& operator--()
+    {
+        if(index == 0) throw std::out_of_range("Cannot decrement iterator");
+        if(index > parent_vec->size) *this = parent_vec->iteratorAt(index - 1);
+        else
+        {
+            --index;
+            if(offset == 0)
+            {
+                leaf = leaf->prev;
+                offset = leaf->count;
+            }
+            --offset;
+        }
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        if(leaf && d >= 0 && offset + d < leaf->count)
+            return ConstIterator(parent_vec, leaf, offset + d, index + d);
+        return parent_vec->iteratorAt(index + d);
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        if(d >= 0 && static_cast<size_type>(d) <= offset && index <= parent_vec->size)
+            return ConstIterator(parent_vec, leaf, offset - d, index - d);
+        return parent_vec->iteratorAt(index - d);
+    }
+
+    bool operator==(const ConstIterator& other) const
+    {
+        return parent_vec == other.parent_vec && index == other.index;
+    }
+
+    bool operator!=(const ConstIterator& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+template <typename Type>
+class BTreeVector<Type>::Iterator : public BTreeVector<Type>::ConstIterator
+{
+public:
+    using pointer = typename BTreeVector::pointer;
+    using reference = typename BTreeVector::reference;
+
+    explicit Iterator()
+    {}
+
+    Iterator(const ConstIterator& other) : ConstIterator(other)
+    {}
+
+    Iterator& operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator& operator--()
+    {
+        ConstIterator::operator--();
+        return *this;
+    }
+
+    Iterator operator--(int)
+    {
+        auto result = *this;
+        ConstIterator::operator--();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    Iterator operator-(difference_type d) const
+    {
+        return ConstIterator::operator-(d);
+    }
+
+    reference operator*() const
+    {
+        // ugly cast, yet reduces code duplication.
+        return const_cast<reference>(ConstIterator::operator*());
+    }
+};
+
+}
+
+#endif // AISDI_LINEAR_BTREEVECTOR_H
@@ -0,0 +1,75 @@
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "BenchmarkUtils.h"
+#include "Vector.h"
+#include "VectorBatch.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+
+//Every tick inserts *perTick* values at random positions and erases half as many
+void perfomTest(std::size_t size, std::size_t perTick, std::size_t ticks)
+{
+    aisdi::Vector<int> sequential;
+    sequential.resize(size);
+    aisdi::Vector<int> batched = sequential;
+
+    unsigned seed = 2016;
+    const double sequentialMs = measureMs([&]
+    {
+        for(std::size_t tick = 0; tick < ticks; ++tick)
+            for(std::size_t i = 0; i < perTick; ++i)
+            {
+                seed = seed * 1103515245u + 12345u;
+                if(i % 3 == 2) sequential.erase(sequential.begin() + (seed >> 4) % sequential.getSize());
+                else sequential.insert(sequential.begin() + (seed >> 4) % (sequential.getSize() + 1), static_cast<int>(i));
+            }
+    });
+
+    seed = 2016;
+    aisdi::VectorBatch<int> batch;
+    const double batchedMs = measureMs([&]
+    {
+        for(std::size_t tick = 0; tick < ticks; ++tick)
+        {
+            std::size_t currentSize = batched.getSize();
+            batch.clear();
+            for(std::size_t i = 0; i < perTick; ++i)
+            {
+                seed = seed * 1103515245u + 12345u;
+                if(i % 3 == 2) batch.erase((seed >> 4) % currentSize--);
+                else batch.insert((seed >> 4) % (currentSize++ + 1), static_cast<int>(i));
+            }
+            batch.applyTo(batched);
+        }
+    });
+
+    bool same = sequential.getSize() == batched.getSize();
+    for(std::size_t i = 0; same && i < sequential.getSize(); ++i)
+        same = sequential.data()[i] == batched.data()[i];
+
+    std::cout << size << " ints, " << ticks << " ticks of " << perTick << " operations" << std::endl
+              << std::fixed << std::setprecision(1)
+              << "one by one: " << sequentialMs << " ms" << std::endl
+              << "batched:    " << batchedMs << " ms" << std::endl;
+    if(!same) std::cout << "Results differ!" << std::endl;
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const std::size_t size = argc > 1 ? std::atoll(argv[1]) : 1000000;
+    const std::size_t perTick = argc > 2 ? std::atoll(argv[2]) : 300;
+    const std::size_t ticks = argc > 3 ? std::atoll(argv[3]) : 10;
+
+    perfomTest(size, perTick, ticks);
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
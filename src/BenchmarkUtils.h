@@ -0,0 +1,35 @@
+#ifndef AISDI_LINEAR_BENCHMARKUTILS_H
+#define AISDI_LINEAR_BENCHMARKUTILS_H
+
+#include <chrono>
+
+namespace aisdi
+{
+namespace benchmark
+{
+
+using Clock = std::chrono::steady_clock;
+
+//Wall-clock time of a single call of *f* in milliseconds
+template <typename Function>
+double measureMs(Function f)
+{
+    Clock::time_point start = Clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+//Average wall-clock time of *repeats* calls of *f* in milliseconds
+template <typename Function>
+double measureMs(int repeats, Function f)
+{
+    Clock::time_point start = Clock::now();
+    for(int i = 0; i < repeats; ++i)
+        f();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / repeats;
+}
+
+}
+}
+
+#endif // AISDI_LINEAR_BENCHMARKUTILS_H
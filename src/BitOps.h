@@ -0,0 +1,62 @@
+#ifndef AISDI_LINEAR_BITOPS_H
+#define AISDI_LINEAR_BITOPS_H
+
+#include <cstdint>
+
+namespace aisdi
+{
+namespace bits
+{
+
+const unsigned WORD_BITS = 64;
+
+//GCC and Clang lower these to popcnt/tzcnt/lzcnt (or bsf/bsr) when the target has them;
+//the portable versions are only used by other compilers
+inline unsigned popCount(std::uint64_t word)
+{
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_popcountll(word));
+#else
+    unsigned count = 0;
+    for(; word; word &= word - 1)
+        ++count;
+    return count;
+#endif
+}
+
+//Index of the lowest set bit, *word* must not be 0
+inline unsigned countTrailingZeros(std::uint64_t word)
+{
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+    unsigned count = 0;
+    for(; !(word & 1); word >>= 1)
+        ++count;
+    return count;
+#endif
+}
+
+//Number of zero bits above the highest set bit, *word* must not be 0
+inline unsigned countLeadingZeros(std::uint64_t word)
+{
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_clzll(word));
+#else
+    unsigned count = 0;
+    for(; !(word >> 63); word <<= 1)
+        ++count;
+    return count;
+#endif
+}
+
+//Mask with bits [0, count) set, *count* up to WORD_BITS
+inline std::uint64_t lowMask(unsigned count)
+{
+    return count >= WORD_BITS ? ~std::uint64_t(0) : (std::uint64_t(1) << count) - 1;
+}
+
+}
+}
+
+#endif // AISDI_LINEAR_BITOPS_H
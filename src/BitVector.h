@@ -0,0 +1,640 @@
+#ifndef AISDI_LINEAR_BITVECTOR_H
+#define AISDI_LINEAR_BITVECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+
+#include "BitOps.h"
+
+namespace aisdi
+{
+
+template <typename Derived>
+class VectorExpression;
+
+//Vector of flags packed 64 to a word. Elements are read as bool and written through
+//a Reference proxy. Bits past the last element are always zero, so count, findFirst/findNext,
+//the bitwise operators and the shifts work on whole words.
+//Vector<bool> keeps a byte per flag, because the containers built on Vector hand out bool&
+//and pointers into its storage; bitmaps that do not need them should use BitVector.
+class BitVector
+{
+public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = bool;
+    using word_type = std::uint64_t;
+    using const_reference = bool;
+
+    class Reference;
+    class ConstIterator;
+    class Iterator;
+    using reference = Reference;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+private:
+    size_type size; //Number of flags currently stored in vector
+    size_type capacity; //Number of allocated words
+    word_type *words;
+    const double INCREASE_FACTOR = 0.5; //Factor by which the capacity will be increased when reallocation is needed
+
+    static size_type wordsFor(size_type bitCount)
+    {
+        return (bitCount + bits::WORD_BITS - 1) / bits::WORD_BITS;
+    }
+
+    size_type usedWords() const
+    {
+        return wordsFor(size);
+    }
+
+    void reallocate(size_type newCapacity)
+    {
+        word_type *new_space = new word_type[newCapacity]();
+        std::copy(words, words + usedWords(), new_space);
+        delete[] words;
+        words = new_space;
+        capacity = newCapacity;
+    }
+
+    //Zero the bits from *newSize* up to the current size, then make *newSize* the size
+    void truncate(size_type newSize)
+    {
+        const size_type firstWord = newSize / bits::WORD_BITS;
+        const size_type lastWord = usedWords();
+        if(firstWord < lastWord)
+        {
+            words[firstWord] &= bits::lowMask(newSize % bits::WORD_BITS);
+            std::fill(words + firstWord + 1, words + lastWord, word_type(0));
+        }
+        size = newSize;
+    }
+
+    //*count* bits starting at bit *position*, in the low bits of the result
+    word_type readBits(size_type position, unsigned count) const
+    {
+        const size_type word = position / bits::WORD_BITS;
+        const unsigned offset = position % bits::WORD_BITS;
+        word_type result = words[word] >> offset;
+        if(offset + count > bits::WORD_BITS) result |= words[word + 1] << (bits::WORD_BITS - offset);
+        return result & bits::lowMask(count);
+    }
+
+    //Move bits [from, size) down to *to* and drop the ones in between
+    void moveDown(size_type to, size_type from)
+    {
+        size_type remaining = size - from;
+        const size_type newSize = to + remaining;
+        while(remaining > 0)
+        {
+            const unsigned offset = to % bits::WORD_BITS;
+            const unsigned count = static_cast<unsigned>(std::min<size_type>(bits::WORD_BITS - offset, remaining));
+            const word_type mask = bits::lowMask(count) << offset;
+            word_type& word = words[to / bits::WORD_BITS];
+            word = (word & ~mask) | (readBits(from, count) << offset);
+            to += count;
+            from += count;
+            remaining -= count;
+        }
+        truncate(newSize);
+    }
+
+    //Index of the first set bit at or after *position*, or getSize() if there is none
+    size_type findFrom(size_type position) const
+    {
+        if(position >= size) return size;
+        size_type word = position / bits::WORD_BITS;
+        word_type current = words[word] & ~bits::lowMask(position % bits::WORD_BITS);
+        const size_type last = usedWords();
+        while(!current)
+        {
+            if(++word == last) return size;
+            current = words[word];
+        }
+        return word * bits::WORD_BITS + bits::countTrailingZeros(current);
+    }
+
+    void checkSameSize(const BitVector& other) const
+    {
+        if(size != other.size) throw std::logic_error("Vector sizes differ");
+    }
+
+public:
+    BitVector() : size(0), capacity(0), words(nullptr)
+    {}
+
+    BitVector(std::initializer_list<bool> l) : size(0), capacity(wordsFor(l.size())),
+                    words(capacity ? new word_type[capacity]() : nullptr)
+    {
+        for(bool i : l)
+            append(i);
+    }
+
+    BitVector(const BitVector& other) : size(other.size), capacity(other.usedWords()),
+                    words(capacity ? new word_type[capacity] : nullptr)
+    {
+        std::copy(other.words, other.words + capacity, words);
+    }
+
+    BitVector(BitVector&& other) : size(other.size), capacity(other.capacity), words(other.words)
+    {
+        other.size = 0;
+        other.capacity = 0;
+        other.words = nullptr;
+    }
+
+    ~BitVector()
+    {
+        delete[] words;
+    }
+
+    friend void swap(BitVector& first, BitVector& second)
+    {
+        using std::swap;
+        swap(first.size, second.size);
+        swap(first.capacity, second.capacity);
+        swap(first.words, second.words);
+    }
+
+    BitVector& operator=(BitVector other)
+    {
+        swap(*this, other);
+        return *this;
+    }
+
+    //Evaluate a lazy expression (see VectorExpressions.h) into the existing storage
+    template <typename Expression>
+    BitVector& operator=(const VectorExpression<Expression>& expression)
+    {
+        assign(*this, expression);
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return size<=0;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    //Number of flags that fit without reallocation
+    size_type getCapacity() const
+    {
+        return capacity * bits::WORD_BITS;
+    }
+
+    //Packed storage, bit i of the vector is bit i % 64 of word i / 64. Writers must leave
+    //the bits past getSize() zero.
+    word_type* getWords()
+    {
+        return words;
+    }
+
+    const word_type* getWords() const
+    {
+        return words;
+    }
+
+    size_type getWordCount() const
+    {
+        return usedWords();
+    }
+
+    //Make sure there is space for at least *newCapacity* flags
+    void reserve(size_type newCapacity)
+    {
+        if(wordsFor(newCapacity) > capacity) reallocate(wordsFor(newCapacity));
+    }
+
+    //Change the number of stored flags, new ones are false
+    void resize(size_type newSize)
+    {
+        reserve(newSize);
+        if(newSize < size) truncate(newSize);
+        else size = newSize;
+    }
+
+    bool operator[](size_type index) const
+    {
+        return (words[index / bits::WORD_BITS] >> (index % bits::WORD_BITS)) & 1;
+    }
+
+    Reference operator[](size_type index);
+
+    void append(bool item);
+    void prepend(bool item);
+
+    void insert(const const_iterator& insertPosition, bool item);
+
+    value_type popFirst()
+    {
+        if(isEmpty()) throw std::logic_error("Vector is empty");
+        const bool temp = static_cast<const BitVector&>(*this)[0];
+        moveDown(0, 1);
+        return temp;
+    }
+
+    value_type popLast()
+    {
+        if(isEmpty()) throw std::logic_error("Vector is empty");
+        const bool temp = static_cast<const BitVector&>(*this)[size - 1];
+        truncate(size - 1);
+        return temp;
+    }
+
+    void erase(const const_iterator& possition);
+
+    void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded);
+
+    //Remove every flag for which pred(flag) is true; returns the number of removed flags.
+    //All kept flags have the same value, so the predicate is asked once per value and the
+    //result is written word by word.
+    template <typename Predicate>
+    size_type eraseIf(Predicate pred)
+    {
+        const bool eraseTrue = pred(true);
+        const bool eraseFalse = pred(false);
+        const size_type ones = count();
+        size_type kept = size;
+        if(eraseTrue && eraseFalse) kept = 0;
+        else if(eraseTrue) kept = size - ones;
+        else if(eraseFalse) kept = ones;
+        else return 0;
+
+        const size_type removed = size - kept;
+        truncate(0);
+        size = kept;
+        if(!eraseTrue)
+        {
+            std::fill(words, words + kept / bits::WORD_BITS, ~word_type(0));
+            if(kept % bits::WORD_BITS) words[kept / bits::WORD_BITS] = bits::lowMask(kept % bits::WORD_BITS);
+        }
+        return removed;
+    }
+
+    //Number of set flags
+    size_type count() const
+    {
+        size_type result = 0;
+        for(size_type i=0; i<usedWords(); ++i)
+            result += bits::popCount(words[i]);
+        return result;
+    }
+
+    //Index of the first set flag, or getSize() if there is none
+    size_type findFirst() const
+    {
+        return findFrom(0);
+    }
+
+    //Index of the first set flag after *index*, or getSize() if there is none
+    size_type findNext(size_type index) const
+    {
+        return findFrom(index + 1);
+    }
+
+    BitVector& operator&=(const BitVector& other)
+    {
+        checkSameSize(other);
+        for(size_type i=0; i<usedWords(); ++i)
+            words[i] &= other.words[i];
+        return *this;
+    }
+
+    BitVector& operator|=(const BitVector& other)
+    {
+        checkSameSize(other);
+        for(size_type i=0; i<usedWords(); ++i)
+            words[i] |= other.words[i];
+        return *this;
+    }
+
+    BitVector& operator^=(const BitVector& other)
+    {
+        checkSameSize(other);
+        for(size_type i=0; i<usedWords(); ++i)
+            words[i] ^= other.words[i];
+        return *this;
+    }
+
+    //Negate every flag
+    void flip()
+    {
+        for(size_type i=0; i<usedWords(); ++i)
+            words[i] = ~words[i];
+        truncate(size);
+    }
+
+    //Move every flag *count* positions towards the end; the first *count* flags become false and
+    //the ones shifted past the end are lost. The size does not change.
+    BitVector& operator<<=(size_type count);
+
+    //Move every flag *count* positions towards the beginning; the last *count* flags become false
+    BitVector& operator>>=(size_type count);
+
+    iterator begin();
+    iterator end();
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    const_iterator begin() const;
+    const_iterator end() const;
+};
+
+//Writable view of a single flag
+class BitVector::Reference
+{
+private:
+    word_type* word;
+    word_type mask;
+
+public:
+    Reference(word_type* w, unsigned bit) : word(w), mask(word_type(1) << bit)
+    {}
+
+    operator bool() const
+    {
+        return (*word & mask) != 0;
+    }
+
+    Reference& operator=(bool value)
+    {
+        if(value) *word |= mask;
+        else *word &= ~mask;
+        return *this;
+    }
+
+    Reference& operator=(const Reference& other)
+    {
+        return *this = static_cast<bool>(other);
+    }
+
+    void flip()
+    {
+        *word ^= mask;
+    }
+};
+
+class BitVector::ConstIterator
+{
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = bool;
+    using difference_type = BitVector::difference_type;
+    using pointer = void;
+    using reference = bool;
+
+protected:
+    size_type index;
+    const BitVector* parent_vec;
+
+public:
+
+    explicit ConstIterator()
+    {}
+
+    ConstIterator(const BitVector* parent, size_type i) : index(i), parent_vec(parent)
+    {}
+
+    reference operator*() const
+    {
+        if(index >= parent_vec->size) throw std::out_of_range("Iterator points at empty space after the last element");
+        return (*parent_vec)[index];
+    }
+
+    ConstIterator& operator++()
+    {
+        if(index >= parent_vec->size) throw std::out_of_range("Cannot increment iterator");
+        ++index;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    ConstIterator& operator--()
+    {
+        if(index == 0) throw std::out_of_range("Cannot decrement iterator");
+        --index;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        return ConstIterator(parent_vec, index+d);
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        return ConstIterator(parent_vec, index-d);
+    }
+
+    bool operator==(const ConstIterator& other) const
+    {
+        return index==other.index;
+    }
+
+    bool operator!=(const ConstIterator& other) const
+    {
+        return index!=other.index;
+    }
+
+    //Position of the iterator in its vector
+    size_type getIndex() const
+    {
+        return index;
+    }
+};
+
+class BitVector::Iterator : public BitVector::ConstIterator
+{
+public:
+    using pointer = void;
+    using reference = BitVector::Reference;
+
+    explicit Iterator()
+    {}
+
+    Iterator(const ConstIterator& other) : ConstIterator(other)
+    {}
+
+    Iterator& operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator& operator--()
+    {
+        ConstIterator::operator--();
+        return *this;
+    }
+
+    Iterator operator--(int)
+    {
+        auto result = *this;
+        ConstIterator::operator--();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    Iterator operator-(difference_type d) const
+    {
+        return ConstIterator::operator-(d);
+    }
+
+    reference operator*() const
+    {
+        ConstIterator::operator*();
+        // ugly cast, yet reduces code duplication.
+        return const_cast<BitVector*>(parent_vec)->operator[](index);
+    }
+};
+
+inline BitVector::Reference BitVector::operator[](size_type index)
+{
+    return Reference(words + index / bits::WORD_BITS, static_cast<unsigned>(index % bits::WORD_BITS));
+}
+
+inline BitVector::iterator BitVector::begin()
+{
+    return iterator(const_iterator(this, 0));
+}
+
+inline BitVector::iterator BitVector::end()
+{
+    return iterator(const_iterator(this, size));
+}
+
+inline BitVector::const_iterator BitVector::cbegin() const
+{
+    return const_iterator(this, 0);
+}
+
+inline BitVector::const_iterator BitVector::cend() const
+{
+    return const_iterator(this, size);
+}
+
+inline BitVector::const_iterator BitVector::begin() const
+{
+    return cbegin();
+}
+
+inline BitVector::const_iterator BitVector::end() const
+{
+    return cend();
+}
+
+inline void BitVector::append(bool item)
+{
+    insert(end(), item);
+}
+
+inline void BitVector::prepend(bool item)
+{
+    insert(begin(), item);
+}
+
+inline void BitVector::erase(const const_iterator& possition)
+{
+    erase(possition, possition+1);
+}
+
+//Shift the flags from *insertPosition* on up by one, carrying the top bit of every word
+//into the next one
+inline void BitVector::insert(const const_iterator& insertPosition, bool item)
+{
+    const size_type position = insertPosition.getIndex();
+    if(position > size) throw std::out_of_range("Index out of range");
+    if(size == getCapacity())
+        reallocate(capacity>1 ? static_cast<size_type>(capacity*(1+INCREASE_FACTOR)) : capacity+1);
+
+    const size_type first = position / bits::WORD_BITS;
+    for(size_type word = size / bits::WORD_BITS; word > first; --word)
+        words[word] = (words[word] << 1) | (words[word - 1] >> (bits::WORD_BITS - 1));
+
+    const unsigned offset = position % bits::WORD_BITS;
+    const word_type low = bits::lowMask(offset);
+    words[first] = (words[first] & low) | ((words[first] & ~low) << 1) | (word_type(item) << offset);
+    ++size;
+}
+
+inline void BitVector::erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded)
+{
+    if(isEmpty()) throw std::out_of_range("Vector is empty");
+    if(firstIncluded.getIndex() > lastExcluded.getIndex() || lastExcluded.getIndex() > size)
+        throw std::out_of_range("firstIncluded should be before lastExcluded");
+    moveDown(firstIncluded.getIndex(), lastExcluded.getIndex());
+}
+
+inline BitVector& BitVector::operator<<=(size_type count)
+{
+    const size_type used = usedWords();
+    const size_type wordShift = count / bits::WORD_BITS;
+    const unsigned bitShift = count % bits::WORD_BITS;
+    for(size_type word = used; word-- > 0;)
+    {
+        word_type value = 0;
+        if(word >= wordShift)
+        {
+            const size_type source = word - wordShift;
+            value = words[source] << bitShift;
+            if(bitShift && source > 0) value |= words[source - 1] >> (bits::WORD_BITS - bitShift);
+        }
+        words[word] = value;
+    }
+    truncate(size);
+    return *this;
+}
+
+inline BitVector& BitVector::operator>>=(size_type count)
+{
+    const size_type used = usedWords();
+    const size_type wordShift = count / bits::WORD_BITS;
+    const unsigned bitShift = count % bits::WORD_BITS;
+    for(size_type word = 0; word < used; ++word)
+    {
+        word_type value = 0;
+        if(count < size && word + wordShift < used)
+        {
+            const size_type source = word + wordShift;
+            value = words[source] >> bitShift;
+            if(bitShift && source + 1 < used) value |= words[source + 1] << (bits::WORD_BITS - bitShift);
+        }
+        words[word] = value;
+    }
+    return *this;
+}
+
+}
+
+#endif // AISDI_LINEAR_BITVECTOR_H
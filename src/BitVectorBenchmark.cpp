@@ -0,0 +1,114 @@
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "BenchmarkUtils.h"
+#include "BitVector.h"
+#include "Vector.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+
+bool flagAt(std::size_t i)
+{
+    return (i * 2654435761u) % 1000 < 30; //About 3% of the flags are set
+}
+
+void printRow(const std::string& name, std::size_t bytes, double appendMs, double countMs, double scanMs, double andMs)
+{
+    std::cout << std::left << std::setw(24) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << bytes / 1024 << std::setw(10) << appendMs << std::setw(10) << countMs
+              << std::setw(10) << scanMs << std::setw(10) << andMs << std::endl;
+}
+
+//A byte per flag, as Vector<bool> stores them
+void measureBytes(std::size_t size, std::size_t expected)
+{
+    aisdi::Vector<bool> flags, mask;
+    const double appendMs = measureMs([&]
+    {
+        for(std::size_t i = 0; i < size; ++i)
+            flags.append(flagAt(i));
+    });
+    mask.resize(size);
+    for(std::size_t i = 0; i < size; i += 2)
+        mask.data()[i] = true;
+
+    std::size_t counted = 0, visited = 0;
+    const double countMs = measureMs([&]
+    {
+        for(std::size_t i = 0; i < size; ++i)
+            counted += flags.data()[i];
+    });
+    const double scanMs = measureMs([&]
+    {
+        for(std::size_t i = 0; i < size; ++i)
+            if(flags.data()[i]) visited += i;
+    });
+    const double andMs = measureMs([&]
+    {
+        for(std::size_t i = 0; i < size; ++i)
+            flags.data()[i] = flags.data()[i] && mask.data()[i];
+    });
+    printRow("Vector<bool>", flags.getCapacity(), appendMs, countMs, scanMs, andMs);
+    if(counted != expected || visited == 1) std::cout << "Results differ!" << std::endl;
+}
+
+void measurePacked(std::size_t size, std::size_t expected)
+{
+    aisdi::BitVector flags, mask;
+    const double appendMs = measureMs([&]
+    {
+        for(std::size_t i = 0; i < size; ++i)
+            flags.append(flagAt(i));
+    });
+    mask.resize(size);
+    for(std::size_t i = 0; i < size; i += 2)
+        mask[i] = true;
+
+    std::size_t counted = 0, visited = 0;
+    const double countMs = measureMs([&]
+    {
+        counted = flags.count();
+    });
+    const double scanMs = measureMs([&]
+    {
+        for(std::size_t i = flags.findFirst(); i != flags.getSize(); i = flags.findNext(i))
+            visited += i;
+    });
+    const double andMs = measureMs([&]
+    {
+        flags &= mask;
+    });
+    printRow("BitVector", flags.getCapacity() / 8, appendMs, countMs, scanMs, andMs);
+    if(counted != expected || visited == 1) std::cout << "Results differ!" << std::endl;
+}
+
+void perfomTest(std::size_t size)
+{
+    std::size_t expected = 0;
+    for(std::size_t i = 0; i < size; ++i)
+        expected += flagAt(i);
+
+    std::cout << size << " flags, " << expected << " set" << std::endl
+              << std::left << std::setw(24) << "" << std::right << std::setw(12) << "KiB" << std::setw(10) << "append"
+              << std::setw(10) << "count" << std::setw(10) << "find set" << std::setw(10) << "and" << "   [ms]" << std::endl;
+    measureBytes(size, expected);
+    measurePacked(size, expected);
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const std::size_t size = argc > 1 ? std::atoll(argv[1]) : 10000000;
+
+    perfomTest(size);
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
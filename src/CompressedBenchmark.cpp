@@ -0,0 +1,101 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "CompressedVector.h"
+#include "Vector.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+
+std::vector<std::uint64_t> makeValues(const std::string& pattern, std::size_t size)
+{
+    std::vector<std::uint64_t> values(size);
+    std::uint64_t id = 1ULL << 40;
+    unsigned seed = 2016;
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        if(pattern == "sorted, gaps < 16") id += (seed >> 16) % 16;
+        else if(pattern == "sorted, gaps < 4096") id += (seed >> 8) % 4096;
+        else if(pattern == "nearly sorted") id = (1ULL << 40) + i * 8 + (seed >> 16) % 64;
+        else id = (std::uint64_t(seed) << 32) ^ (seed * 2654435761u); //random 64-bit
+        values[i] = id;
+    }
+    return values;
+}
+
+void perfomTest(std::size_t size, std::size_t lookups)
+{
+    std::cout << size << " uint64 values, " << lookups << " random lookups" << std::endl
+              << std::left << std::setw(22) << "" << std::right << std::setw(8) << "ratio" << std::setw(10) << "bits/val"
+              << std::setw(10) << "append" << std::setw(14) << "scan Vector" << std::setw(14) << "decode"
+              << std::setw(12) << "lookups" << "   [ms]" << std::endl;
+
+    for(const char* pattern : { "sorted, gaps < 16", "sorted, gaps < 4096", "nearly sorted", "random" })
+    {
+        const std::vector<std::uint64_t> values = makeValues(pattern, size);
+        aisdi::Vector<std::uint64_t> plain;
+        plain.resize(size);
+        std::copy(values.begin(), values.end(), plain.data());
+
+        aisdi::CompressedVector compressed;
+        const double appendMs = measureMs([&]
+        {
+            for(std::uint64_t value : values)
+                compressed.append(value);
+        });
+
+        std::uint64_t plainSum = 0, decodedSum = 0, lookupSum = 0, expectedLookupSum = 0;
+        const double scanMs = measureMs([&]
+        {
+            for(std::size_t i = 0; i < size; ++i)
+                plainSum += plain.data()[i];
+        });
+        const double decodeMs = measureMs([&]
+        {
+            compressed.forEach([&decodedSum](std::uint64_t value) { decodedSum += value; });
+        });
+
+        std::vector<std::size_t> positions(lookups);
+        unsigned seed = 7;
+        for(std::size_t& position : positions)
+        {
+            seed = seed * 1103515245u + 12345u;
+            position = seed % size;
+            expectedLookupSum += values[position];
+        }
+        const double lookupMs = measureMs([&]
+        {
+            for(std::size_t position : positions)
+                lookupSum += compressed[position];
+        });
+
+        const double bytes = static_cast<double>(compressed.getCompressedBytes());
+        std::cout << std::left << std::setw(22) << pattern << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(8) << size * sizeof(std::uint64_t) / bytes << std::setw(10) << bytes * 8 / size
+                  << std::setprecision(1) << std::setw(10) << appendMs << std::setw(14) << scanMs
+                  << std::setw(14) << decodeMs << std::setw(12) << lookupMs << std::endl;
+        if(plainSum != decodedSum || lookupSum != expectedLookupSum) std::cout << "Results differ!" << std::endl;
+    }
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const std::size_t size = argc > 1 ? std::atoll(argv[1]) : 10000000;
+    const std::size_t lookups = argc > 2 ? std::atoll(argv[2]) : 1000000;
+
+    perfomTest(size, lookups);
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,461 @@
+#ifndef AISDI_LINEAR_COMPRESSEDVECTOR_H
+#define AISDI_LINEAR_COMPRESSEDVECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+
+#include "BitOps.h"
+#include "SimdKernels.h"
+#include "Vector.h"
+
+namespace aisdi
+{
+namespace compressed
+{
+
+const std::size_t BLOCK_SIZE = 256; //Values per encoded block
+const std::size_t LANES = 4; //Interleaved bit streams per block
+const std::size_t PER_LANE = BLOCK_SIZE / LANES;
+const std::size_t NO_BLOCK = static_cast<std::size_t>(-1);
+
+namespace detail
+{
+
+//Bits needed to store *value*
+inline unsigned bitWidth(std::uint64_t value)
+{
+    return value ? bits::WORD_BITS - bits::countLeadingZeros(value) : 0;
+}
+
+//Value *index* of a block packed with *width* bits per value. Value i lives in stream i % LANES
+//at position i / LANES; word k of stream s is word k * LANES + s of the block.
+inline std::uint64_t extract(const std::uint64_t* in, unsigned width, std::size_t index)
+{
+    const std::size_t lane = index % LANES;
+    const std::size_t bit = index / LANES * width;
+    const std::size_t word = bit / bits::WORD_BITS;
+    const unsigned offset = bit % bits::WORD_BITS;
+    std::uint64_t value = in[word * LANES + lane] >> offset;
+    if(offset + width > bits::WORD_BITS) value |= in[(word + 1) * LANES + lane] << (bits::WORD_BITS - offset);
+    return value & bits::lowMask(width);
+}
+
+//Pack BLOCK_SIZE values into width * LANES zeroed words of *out*
+inline void pack(const std::uint64_t* values, unsigned width, std::uint64_t* out)
+{
+    if(width == 0) return;
+    for(std::size_t i = 0; i < BLOCK_SIZE; ++i)
+    {
+        const std::size_t lane = i % LANES;
+        const std::size_t bit = i / LANES * width;
+        const std::size_t word = bit / bits::WORD_BITS;
+        const unsigned offset = bit % bits::WORD_BITS;
+        out[word * LANES + lane] |= values[i] << offset;
+        if(offset + width > bits::WORD_BITS) out[(word + 1) * LANES + lane] |= values[i] >> (bits::WORD_BITS - offset);
+    }
+}
+
+//Unpack the first *rows* positions of every stream of a block (rows * LANES values) and add
+//*base* to every value
+inline void unpackScalar(const std::uint64_t* in, unsigned width, std::uint64_t base, std::uint64_t* out,
+                         std::size_t rows = PER_LANE)
+{
+    for(std::size_t i = 0; i < rows * LANES; ++i)
+        out[i] = extract(in, width, i) + base;
+}
+
+#ifdef AISDI_SIMD_VECTOR_EXTENSIONS
+
+template <std::size_t Bytes>
+struct Lanes;
+
+template <>
+struct Lanes<16>
+{
+    typedef std::uint64_t type __attribute__((vector_size(16)));
+};
+
+template <>
+struct Lanes<32>
+{
+    typedef std::uint64_t type __attribute__((vector_size(32)));
+};
+
+//The streams of a block sit next to each other in memory, so one register holds the same
+//position of several streams and every lane is shifted by the same amount
+template <std::size_t Bytes>
+AISDI_SIMD_INLINE void unpackKernel(const std::uint64_t* in, unsigned width, std::uint64_t base, std::uint64_t* out,
+                                    std::size_t rows)
+{
+    using Block = typename Lanes<Bytes>::type;
+    const std::size_t lanes = Bytes / sizeof(std::uint64_t);
+    Block mask, offsetBase, low, high;
+    simd::detail::broadcast(mask, bits::lowMask(width));
+    simd::detail::broadcast(offsetBase, base);
+
+    for(std::size_t group = 0; group < LANES; group += lanes)
+        for(std::size_t position = 0; position < rows; ++position)
+        {
+            const std::size_t bit = position * width;
+            const std::size_t word = bit / bits::WORD_BITS;
+            const unsigned offset = bit % bits::WORD_BITS;
+            simd::detail::load(low, in + word * LANES + group);
+            low = low >> offset;
+            if(offset + width > bits::WORD_BITS)
+            {
+                simd::detail::load(high, in + (word + 1) * LANES + group);
+                low |= high << (bits::WORD_BITS - offset);
+            }
+            low = (low & mask) + offsetBase;
+            std::memcpy(out + position * LANES + group, &low, Bytes);
+        }
+}
+
+#ifdef AISDI_SIMD_X86
+AISDI_SIMD_TARGET_AVX2 inline void unpackAvx2(const std::uint64_t* in, unsigned width, std::uint64_t base,
+                                              std::uint64_t* out, std::size_t rows)
+{
+    unpackKernel<32>(in, width, base, out, rows);
+}
+#endif
+
+#endif // AISDI_SIMD_VECTOR_EXTENSIONS
+
+inline void unpack(const std::uint64_t* in, unsigned width, std::uint64_t base, std::uint64_t* out,
+                   std::size_t rows = PER_LANE)
+{
+    if(width == 0)
+    {
+        for(std::size_t i = 0; i < rows * LANES; ++i)
+            out[i] = base;
+        return;
+    }
+#ifdef AISDI_SIMD_VECTOR_EXTENSIONS
+#  ifdef AISDI_SIMD_X86
+    if(simd::detail::hasAvx2()) return unpackAvx2(in, width, base, out, rows);
+#  endif
+    unpackKernel<16>(in, width, base, out, rows);
+#else
+    unpackScalar(in, width, base, out, rows);
+#endif
+}
+
+}
+}
+
+//Append-only vector of 64-bit unsigned integers compressed in blocks of BLOCK_SIZE values.
+//Each block stores its smallest value and bit-packs the differences to it (frame of reference)
+//or, when the block is non-decreasing and this is narrower, the differences between neighbours
+//(delta). Sorted ID lists with small gaps shrink to a few bits per value. The last, incomplete
+//block stays uncompressed until it fills up.
+//Random access reads the block header and at most one block; iterating decodes a block at a time.
+class CompressedVector
+{
+public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = std::uint64_t;
+    using const_reference = value_type;
+
+    class ConstIterator;
+    using const_iterator = ConstIterator;
+    using iterator = ConstIterator;
+
+private:
+    struct Block
+    {
+        value_type base; //Smallest value (frame of reference) or first value (delta)
+        size_type offset; //Position of the packed words in *packed*
+        unsigned width; //Bits per packed value
+        bool delta;
+    };
+
+    Vector<Block> blocks;
+    Vector<value_type> packed;
+    Vector<value_type> tail; //Values appended since the last full block
+
+    void seal()
+    {
+        const value_type* values = tail.data();
+        value_type low = values[0], high = values[0], largestStep = 0;
+        bool ascending = true;
+        for(size_type i = 1; i < compressed::BLOCK_SIZE; ++i)
+        {
+            if(values[i] < low) low = values[i];
+            if(values[i] > high) high = values[i];
+            if(values[i] < values[i - 1]) ascending = false;
+            else if(values[i] - values[i - 1] > largestStep) largestStep = values[i] - values[i - 1];
+        }
+
+        Block block;
+        block.offset = packed.getSize();
+        block.delta = ascending && compressed::detail::bitWidth(largestStep) < compressed::detail::bitWidth(high - low);
+        block.width = compressed::detail::bitWidth(block.delta ? largestStep : high - low);
+        block.base = block.delta ? values[0] : low;
+
+        value_type differences[compressed::BLOCK_SIZE];
+        for(size_type i = 0; i < compressed::BLOCK_SIZE; ++i)
+            differences[i] = block.delta ? (i ? values[i] - values[i - 1] : 0) : values[i] - low;
+        const size_type needed = packed.getSize() + block.width * compressed::LANES;
+        if(needed > packed.getCapacity()) packed.reserve(std::max(needed, packed.getCapacity() + packed.getCapacity() / 2));
+        packed.resize(needed);
+        compressed::detail::pack(differences, block.width, packed.data() + block.offset);
+
+        blocks.append(block);
+        tail.resize(0);
+    }
+
+public:
+    CompressedVector()
+    {}
+
+    CompressedVector(std::initializer_list<value_type> l)
+    {
+        for(value_type item : l)
+            append(item);
+    }
+
+    bool isEmpty() const
+    {
+        return getSize() == 0;
+    }
+
+    size_type getSize() const
+    {
+        return blocks.getSize() * compressed::BLOCK_SIZE + tail.getSize();
+    }
+
+    //Bytes of encoded data and block headers, including the space of the uncompressed tail
+    size_type getCompressedBytes() const
+    {
+        return packed.getSize() * sizeof(value_type) + blocks.getSize() * sizeof(Block)
+                + tail.getCapacity() * sizeof(value_type);
+    }
+
+    size_type getBlockCount() const
+    {
+        return blocks.getSize();
+    }
+
+    void append(value_type item)
+    {
+        if(tail.isEmpty()) tail.reserve(compressed::BLOCK_SIZE);
+        tail.append(item);
+        if(tail.getSize() == compressed::BLOCK_SIZE) seal();
+    }
+
+    //Write the BLOCK_SIZE values of block *index* to *out*
+    void decodeBlock(size_type index, value_type* out) const
+    {
+        if(index >= blocks.getSize()) throw std::out_of_range("Index out of range");
+        const Block& block = blocks.data()[index];
+        const value_type* in = packed.data() + block.offset;
+        compressed::detail::unpack(in, block.width, block.delta ? 0 : block.base, out);
+        if(!block.delta) return;
+        out[0] = block.base;
+        for(size_type i = 1; i < compressed::BLOCK_SIZE; ++i)
+            out[i] += out[i - 1];
+    }
+
+    value_type operator[](size_type index) const
+    {
+        const size_type blockIndex = index / compressed::BLOCK_SIZE;
+        const size_type position = index % compressed::BLOCK_SIZE;
+        if(blockIndex == blocks.getSize()) return tail.data()[position];
+
+        const Block& block = blocks.data()[blockIndex];
+        const value_type* in = packed.data() + block.offset;
+        if(!block.delta) return block.base + compressed::detail::extract(in, block.width, position);
+
+        //Delta blocks are summed up to *position*, after unpacking only the rows that hold it
+        value_type deltas[compressed::BLOCK_SIZE];
+        compressed::detail::unpack(in, block.width, 0, deltas, position / compressed::LANES + 1);
+        value_type result = block.base;
+        for(size_type i = 1; i <= position; ++i)
+            result += deltas[i];
+        return result;
+    }
+
+    value_type at(size_type index) const
+    {
+        if(index >= getSize()) throw std::out_of_range("Index out of range");
+        return (*this)[index];
+    }
+
+    //Call f(value) for every value in order, decoding one block at a time
+    template <typename Function>
+    void forEach(Function f) const
+    {
+        value_type buffer[compressed::BLOCK_SIZE];
+        for(size_type b = 0; b < blocks.getSize(); ++b)
+        {
+            decodeBlock(b, buffer);
+            for(size_type i = 0; i < compressed::BLOCK_SIZE; ++i)
+                f(buffer[i]);
+        }
+        for(size_type i = 0; i < tail.getSize(); ++i)
+            f(tail.data()[i]);
+    }
+
+    //All values, uncompressed
+    Vector<value_type> decode() const
+    {
+        Vector<value_type> result;
+        result.resize(getSize());
+        value_type* out = result.data();
+        for(size_type b = 0; b < blocks.getSize(); ++b)
+            decodeBlock(b, out + b * compressed::BLOCK_SIZE);
+        std::copy(tail.data(), tail.data() + tail.getSize(), out + blocks.getSize() * compressed::BLOCK_SIZE);
+        return result;
+    }
+
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+};
+
+//Keeps the block it points into decoded, so walking the vector decodes every block once.
+//Copies share the decoded block, so *it++ decodes nothing either; copies of one iterator must
+//not be dereferenced from different threads at the same time.
+class CompressedVector::ConstIterator
+{
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = CompressedVector::value_type;
+    using difference_type = CompressedVector::difference_type;
+    using pointer = const value_type*;
+    using reference = value_type;
+
+private:
+    struct DecodedBlock
+    {
+        size_type block;
+        value_type values[compressed::BLOCK_SIZE];
+    };
+
+    const CompressedVector* parent;
+    size_type index;
+    mutable std::shared_ptr<DecodedBlock> decoded;
+
+    //Decoded block, allocated on first use so that iterators which are only compared stay cheap
+    const std::shared_ptr<DecodedBlock>& shared() const
+    {
+        if(!decoded)
+        {
+            decoded.reset(new DecodedBlock);
+            decoded->block = compressed::NO_BLOCK;
+        }
+        return decoded;
+    }
+
+public:
+    explicit ConstIterator()
+    {}
+
+    ConstIterator(const CompressedVector* p, size_type i) : parent(p), index(i)
+    {}
+
+    ConstIterator(const ConstIterator& other) : parent(other.parent), index(other.index), decoded(other.shared())
+    {}
+
+    ConstIterator& operator=(const ConstIterator& other)
+    {
+        parent = other.parent;
+        index = other.index;
+        decoded = other.shared();
+        return *this;
+    }
+
+    reference operator*() const
+    {
+        if(index >= parent->getSize()) throw std::out_of_range("Iterator points at empty space after the last element");
+        const size_type block = index / compressed::BLOCK_SIZE;
+        if(block == parent->blocks.getSize()) return parent->tail.data()[index % compressed::BLOCK_SIZE];
+        DecodedBlock& cache = *shared();
+        if(cache.block != block)
+        {
+            parent->decodeBlock(block, cache.values);
+            cache.block = block;
+        }
+        return cache.values[index % compressed::BLOCK_SIZE];
+    }
+
+    ConstIterator& operator++()
+    {
+        if(index >= parent->getSize()) throw std::out_of_range("Cannot increment iterator");
+        ++index;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    ConstIterator& operator--()
+    {
+        if(index == 0) throw std::out_of_range("Cannot decrement iterator");
+        --index;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        return ConstIterator(parent, index + d);
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        return ConstIterator(parent, index - d);
+    }
+
+    bool operator==(const ConstIterator& other) const
+    {
+        return index == other.index;
+    }
+
+    bool operator!=(const ConstIterator& other) const
+    {
+        return index != other.index;
+    }
+};
+
+inline CompressedVector::const_iterator CompressedVector::cbegin() const
+{
+    return const_iterator(this, 0);
+}
+
+inline CompressedVector::const_iterator CompressedVector::cend() const
+{
+    return const_iterator(this, getSize());
+}
+
+inline CompressedVector::const_iterator CompressedVector::begin() const
+{
+    return cbegin();
+}
+
+inline CompressedVector::const_iterator CompressedVector::end() const
+{
+    return cend();
+}
+
+}
+
+#endif // AISDI_LINEAR_COMPRESSEDVECTOR_H
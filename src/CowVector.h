@@ -0,0 +1,342 @@
+#ifndef AISDI_LINEAR_COWVECTOR_H
+#define AISDI_LINEAR_COWVECTOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+
+namespace aisdi
+{
+
+//Copy-on-write Vector: copies share one reference-counted buffer, so copying, assigning and
+//passing by value cost O(1). The buffer is cloned by the first mutating call made through a
+//copy while it is shared. Iterators are read-only, so iterating never clones; elements are
+//written with mutableData(), which clones a shared buffer first.
+//Once mutableData() was handed out, the buffer is no longer shared by later copies (they clone
+//it at once), so writes through an old pointer never reach a copy. It becomes shareable again
+//when the buffer is reallocated, which invalidates such pointers anyway.
+template <typename Type>
+class CowVector
+{
+public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type*;
+    using reference = Type&;
+    using const_pointer = const Type*;
+    using const_reference = const Type&;
+
+    class ConstIterator;
+    using const_iterator = ConstIterator;
+    using iterator = ConstIterator;
+
+private:
+    struct Buffer
+    {
+        std::atomic<size_type> references;
+        size_type size;
+        size_type capacity;
+        value_type *items;
+        bool shareable; //Cleared by mutableData(); only changed while unshared
+
+        explicit Buffer(size_type c) : references(1), size(0), capacity(c), items(new value_type[c]), shareable(true)
+        {}
+
+        ~Buffer()
+        {
+            delete[] items;
+        }
+    };
+
+    Buffer *buffer; //nullptr for an empty vector that never allocated
+    const double INCREASE_FACTOR = 0.5; //Factor by which the capacity will be increased when reallocation is needed
+
+    void release()
+    {
+        if(buffer && buffer->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete buffer;
+        buffer = nullptr;
+    }
+
+    //Make *buffer* owned by this vector alone and able to hold *required* elements
+    void prepareWrite(size_type required)
+    {
+        const size_type capacity = buffer ? buffer->capacity : 0;
+        if(buffer && required <= capacity && buffer->references.load(std::memory_order_acquire) == 1) return;
+
+        size_type newCapacity = capacity;
+        if(required > capacity)
+            newCapacity = std::max<size_type>(required, capacity > 1 ? capacity * (1 + INCREASE_FACTOR) : capacity + 1);
+        Buffer *clone = new Buffer(newCapacity);
+        if(buffer)
+        {
+            std::copy(buffer->items, buffer->items + buffer->size, clone->items);
+            clone->size = buffer->size;
+        }
+        release();
+        buffer = clone;
+    }
+
+    size_type indexOf(const const_iterator& it) const
+    {
+        return buffer ? it.element - buffer->items : 0;
+    }
+
+public:
+    CowVector() : buffer(nullptr)
+    {}
+
+    CowVector(std::initializer_list<Type> l) : buffer(nullptr)
+    {
+        if(l.size() == 0) return;
+        buffer = new Buffer(l.size());
+        std::copy(l.begin(), l.end(), buffer->items);
+        buffer->size = l.size();
+    }
+
+    //Share *other*'s buffer, or clone it if mutableData() has been handed out
+    CowVector(const CowVector& other) : buffer(other.buffer)
+    {
+        if(!buffer) return;
+        if(buffer->shareable)
+        {
+            buffer->references.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        buffer = new Buffer(other.buffer->size);
+        std::copy(other.buffer->items, other.buffer->items + other.buffer->size, buffer->items);
+        buffer->size = other.buffer->size;
+    }
+
+    CowVector(CowVector&& other) : buffer(other.buffer)
+    {
+        other.buffer = nullptr;
+    }
+
+    ~CowVector()
+    {
+        release();
+    }
+
+    friend void swap(CowVector& first, CowVector& second)
+    {
+        using std::swap;
+        swap(first.buffer, second.buffer);
+    }
+
+    CowVector& operator=(CowVector other)
+    {
+        swap(*this, other);
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return getSize() == 0;
+    }
+
+    size_type getSize() const
+    {
+        return buffer ? buffer->size : 0;
+    }
+
+    size_type getCapacity() const
+    {
+        return buffer ? buffer->capacity : 0;
+    }
+
+    //True while another CowVector uses the same buffer
+    bool isShared() const
+    {
+        return buffer && buffer->references.load(std::memory_order_acquire) > 1;
+    }
+
+    const_pointer data() const
+    {
+        return buffer ? buffer->items : nullptr;
+    }
+
+    //Writable access to the elements, cloning a shared buffer first
+    pointer mutableData()
+    {
+        if(!buffer) return nullptr;
+        if(isShared()) prepareWrite(getSize());
+        buffer->shareable = false;
+        return buffer->items;
+    }
+
+    void reserve(size_type newCapacity)
+    {
+        if(newCapacity > getCapacity()) prepareWrite(newCapacity);
+    }
+
+    //Change the number of stored elements, new ones are value-initialized
+    void resize(size_type newSize)
+    {
+        if(newSize == getSize()) return;
+        prepareWrite(newSize);
+        std::fill(buffer->items + std::min(buffer->size, newSize), buffer->items + newSize, value_type());
+        buffer->size = newSize;
+    }
+
+    void append(const Type& item)
+    {
+        insert(cend(), item);
+    }
+
+    void prepend(const Type& item)
+    {
+        insert(cbegin(), item);
+    }
+
+    void insert(const const_iterator& insertPosition, const Type& item)
+    {
+        const size_type index = indexOf(insertPosition);
+        const size_type size = getSize();
+        if(index > size) throw std::out_of_range("Cannot insert outside of the vector");
+        const value_type copy = item; //*item* may live in the buffer that is about to be replaced
+        prepareWrite(size + 1);
+        std::copy_backward(buffer->items + index, buffer->items + size, buffer->items + size + 1);
+        buffer->items[index] = copy;
+        ++buffer->size;
+    }
+
+    value_type popFirst()
+    {
+        if(isEmpty()) throw std::logic_error("Vector is empty");
+        value_type temp = *cbegin();
+        erase(cbegin());
+        return temp;
+    }
+
+    value_type popLast()
+    {
+        if(isEmpty()) throw std::logic_error("Vector is empty");
+        value_type temp = buffer->items[buffer->size - 1];
+        prepareWrite(getSize());
+        --buffer->size;
+        return temp;
+    }
+
+    void erase(const const_iterator& possition)
+    {
+        erase(possition, possition + 1);
+    }
+
+    void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded)
+    {
+        if(isEmpty()) throw std::out_of_range("Vector is empty");
+        const size_type first = indexOf(firstIncluded);
+        const size_type last = indexOf(lastExcluded);
+        if(last < first || last > getSize()) throw std::out_of_range("firstIncluded should be before lastExcluded");
+        if(first == last) return;
+        prepareWrite(getSize());
+        std::copy(buffer->items + last, buffer->items + buffer->size, buffer->items + first);
+        buffer->size -= last - first;
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(this, data());
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(this, data() + getSize());
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+};
+
+template <typename Type>
+class CowVector<Type>::ConstIterator
+{
+public:
+    friend class CowVector<Type>;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename CowVector::value_type;
+    using difference_type = typename CowVector::difference_type;
+    using pointer = typename CowVector::const_pointer;
+    using reference = typename CowVector::const_reference;
+
+private:
+    pointer element;
+    const CowVector<Type>* parent_vec;
+
+public:
+    explicit ConstIterator()
+    {}
+
+    ConstIterator(const CowVector<Type>* parent, pointer ptr) : element(ptr), parent_vec(parent)
+    {}
+
+    reference operator*() const
+    {
+        if(*this == parent_vec->end()) throw std::out_of_range("Iterator points at empty space after the last element");
+        return *element;
+    }
+
+    ConstIterator& operator++()
+    {
+        if(*this == parent_vec->end()) throw std::out_of_range("Cannot increment iterator");
+        ++element;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    ConstIterator& operator--()
+    {
+        if(*this == parent_vec->begin()) throw std::out_of_range("Cannot decrement iterator");
+        --element;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        return ConstIterator(parent_vec, element + d);
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        return ConstIterator(parent_vec, element - d);
+    }
+
+    bool operator==(const ConstIterator& other) const
+    {
+        return element == other.element;
+    }
+
+    bool operator!=(const ConstIterator& other) const
+    {
+        return element != other.element;
+    }
+};
+
+}
+
+#endif // AISDI_LINEAR_COWVECTOR_H
@@ -0,0 +1,637 @@
+#ifndef AISDI_LINEAR_EXTERNALVECTOR_H
+#define AISDI_LINEAR_EXTERNALVECTOR_H
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace aisdi
+{
+
+namespace external
+{
+
+//Temporary file that is unlinked as soon as it is created, so it disappears with the descriptor
+class TemporaryFile
+{
+    int fd;
+
+    static void fail(const char* what)
+    {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+public:
+    explicit TemporaryFile(const std::string& directory) : fd(-1)
+    {
+        std::string path = directory + "/aisdi_external_XXXXXX";
+        std::vector<char> name(path.begin(), path.end());
+        name.push_back('\0');
+        fd = mkstemp(name.data());
+        if(fd < 0) fail("mkstemp");
+        unlink(name.data());
+    }
+
+    TemporaryFile(const TemporaryFile&) = delete;
+    TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+    TemporaryFile(TemporaryFile&& other) : fd(other.fd)
+    {
+        other.fd = -1;
+    }
+
+    ~TemporaryFile()
+    {
+        if(fd >= 0) close(fd);
+    }
+
+    //Read up to *bytes* at *offset*; a short read only happens at the end of the file
+    std::size_t read(void* data, std::size_t bytes, std::uint64_t offset) const
+    {
+        char* p = static_cast<char*>(data);
+        std::size_t done = 0;
+        while(done < bytes)
+        {
+            const ssize_t got = pread(fd, p + done, bytes - done, static_cast<off_t>(offset + done));
+            if(got < 0 && errno == EINTR) continue;
+            if(got < 0) fail("pread");
+            if(got == 0) break;
+            done += got;
+        }
+        return done;
+    }
+
+    void write(const void* data, std::size_t bytes, std::uint64_t offset)
+    {
+        const char* p = static_cast<const char*>(data);
+        std::size_t done = 0;
+        while(done < bytes)
+        {
+            const ssize_t written = pwrite(fd, p + done, bytes - done, static_cast<off_t>(offset + done));
+            if(written < 0 && errno == EINTR) continue;
+            if(written <= 0) fail("pwrite");
+            done += written;
+        }
+    }
+
+    //Ask the kernel to start reading the range in the background
+    void willNeed(std::uint64_t offset, std::uint64_t bytes) const
+    {
+#ifdef POSIX_FADV_WILLNEED
+        posix_fadvise(fd, static_cast<off_t>(offset), static_cast<off_t>(bytes), POSIX_FADV_WILLNEED);
+#else
+        static_cast<void>(offset);
+        static_cast<void>(bytes);
+#endif
+    }
+};
+
+}
+
+//Vector of trivially copyable elements that keeps at most *memoryBudget* bytes of them in
+//memory. Elements are grouped in fixed-size blocks; a bounded cache holds the recently used
+//ones and writes the least recently used block to an unlinked temporary file when it needs
+//room. Loading the block right after the previously loaded one asks the kernel to read ahead,
+//so sequential scans stream from disk. Only blocks that were written to are written back.
+//Const references returned by element access are valid until the next access; writable access
+//goes through a Reference proxy, so that reading a non-const vector leaves its blocks clean.
+template <typename Type>
+class ExternalVector
+{
+    static_assert(std::is_trivially_copyable<Type>::value, "ExternalVector needs trivially copyable elements");
+
+public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type*;
+    using const_pointer = const Type*;
+    using const_reference = const Type&;
+
+    class Reference;
+    using reference = Reference;
+    class ConstIterator;
+    class Iterator;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+    static const size_type DEFAULT_BLOCK_BYTES = 64 * 1024;
+    static const size_type READ_AHEAD_BLOCKS = 4;
+
+private:
+    static const size_type NO_SLOT = static_cast<size_type>(-1);
+
+    struct Slot
+    {
+        size_type block;
+        bool dirty;
+        std::unique_ptr<Type[]> data;
+        size_type newer, older; //Neighbours on the LRU list
+    };
+
+    size_type size;
+    size_type blockElements;
+    size_type maxSlots;
+    std::string directory;
+    mutable external::TemporaryFile file;
+    mutable size_type storedBlocks; //Blocks that have been written to the file at least once
+    mutable size_type writtenBlocks; //Write-backs of evicted or flushed blocks
+
+    //The cache changes on reads too, hence mutable
+    mutable std::vector<Slot> slots;
+    mutable std::vector<size_type> blockSlot; //Slot holding each block, or NO_SLOT
+    mutable size_type mostRecent, leastRecent;
+    mutable size_type lastLoaded;
+
+    size_type blockBytes() const
+    {
+        return blockElements * sizeof(Type);
+    }
+
+    void detach(size_type s) const
+    {
+        Slot& slot = slots[s];
+        if(slot.newer != NO_SLOT) slots[slot.newer].older = slot.older;
+        else mostRecent = slot.older;
+        if(slot.older != NO_SLOT) slots[slot.older].newer = slot.newer;
+        else leastRecent = slot.newer;
+    }
+
+    void makeMostRecent(size_type s) const
+    {
+        slots[s].newer = NO_SLOT;
+        slots[s].older = mostRecent;
+        if(mostRecent != NO_SLOT) slots[mostRecent].newer = s;
+        mostRecent = s;
+        if(leastRecent == NO_SLOT) leastRecent = s;
+    }
+
+    void writeBack(Slot& slot) const
+    {
+        if(!slot.dirty) return;
+        file.write(slot.data.get(), blockBytes(), static_cast<std::uint64_t>(slot.block) * blockBytes());
+        slot.dirty = false;
+        storedBlocks = std::max(storedBlocks, slot.block + 1);
+        ++writtenBlocks;
+    }
+
+    //Bring *block* into the cache, evicting the least recently used block when it is full
+    size_type load(size_type block) const
+    {
+        size_type s;
+        if(slots.size() < maxSlots)
+        {
+            slots.push_back(Slot());
+            s = slots.size() - 1;
+            slots[s].data.reset(new Type[blockElements]);
+        }
+        else
+        {
+            s = leastRecent;
+            detach(s);
+            writeBack(slots[s]);
+            blockSlot[slots[s].block] = NO_SLOT;
+        }
+        makeMostRecent(s);
+        slots[s].block = block;
+        slots[s].dirty = false;
+        if(blockSlot.size() <= block) blockSlot.resize(block + 1, NO_SLOT);
+        blockSlot[block] = s;
+
+        if(block < storedBlocks)
+        {
+            const std::uint64_t offset = static_cast<std::uint64_t>(block) * blockBytes();
+            file.read(slots[s].data.get(), blockBytes(), offset);
+            if(block == lastLoaded + 1 && block + 1 < storedBlocks)
+                file.willNeed(offset + blockBytes(), READ_AHEAD_BLOCKS * blockBytes());
+        }
+        lastLoaded = block;
+        return s;
+    }
+
+    Type* blockData(size_type block, bool forWriting) const
+    {
+        size_type s = block < blockSlot.size() ? blockSlot[block] : NO_SLOT;
+        if(s == NO_SLOT) s = load(block);
+        else if(s != mostRecent)
+        {
+            detach(s);
+            makeMostRecent(s);
+        }
+        if(forWriting) slots[s].dirty = true;
+        return slots[s].data.get();
+    }
+
+    //Write every dirty block and empty the cache
+    void flushCache() const
+    {
+        for(Slot& slot : slots)
+            writeBack(slot);
+        slots.clear();
+        blockSlot.clear();
+        mostRecent = leastRecent = NO_SLOT;
+    }
+
+    //Elements [first, first + count) from/to the file, bypassing the cache
+    void readRange(Type* out, size_type first, size_type count) const
+    {
+        file.read(out, count * sizeof(Type), static_cast<std::uint64_t>(first) * sizeof(Type));
+    }
+
+    struct RunCursor
+    {
+        std::uint64_t next, end; //Elements of the run not yet buffered
+        std::unique_ptr<Type[]> buffer;
+        size_type position, buffered;
+    };
+
+public:
+    explicit ExternalVector(size_type memoryBudget, size_type blockBytes = DEFAULT_BLOCK_BYTES,
+                            const std::string& tempDirectory = "/tmp")
+            : size(0), blockElements(std::max<size_type>(1, blockBytes / sizeof(Type))),
+              maxSlots(std::max<size_type>(2, memoryBudget / (blockElements * sizeof(Type)))),
+              directory(tempDirectory), file(tempDirectory), storedBlocks(0), writtenBlocks(0),
+              mostRecent(NO_SLOT), leastRecent(NO_SLOT), lastLoaded(NO_SLOT)
+    {}
+
+    ExternalVector(const ExternalVector&) = delete;
+    ExternalVector& operator=(const ExternalVector&) = delete;
+
+    bool isEmpty() const
+    {
+        return size == 0;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    size_type getBlockSize() const
+    {
+        return blockElements;
+    }
+
+    //Number of blocks the cache may hold at once
+    size_type getCacheCapacity() const
+    {
+        return maxSlots;
+    }
+
+    size_type getCachedBlocks() const
+    {
+        return slots.size();
+    }
+
+    //Number of blocks written back to the temporary file so far
+    size_type getWrittenBlocks() const
+    {
+        return writtenBlocks;
+    }
+
+    void append(const Type& item)
+    {
+        blockData(size / blockElements, true)[size % blockElements] = item;
+        ++size;
+    }
+
+    value_type popLast()
+    {
+        if(isEmpty()) throw std::logic_error("Vector is empty");
+        --size;
+        return blockData(size / blockElements, false)[size % blockElements];
+    }
+
+    reference operator[](size_type index)
+    {
+        if(index >= size) throw std::out_of_range("Index out of range");
+        return Reference(this, index);
+    }
+
+    const_reference operator[](size_type index) const
+    {
+        if(index >= size) throw std::out_of_range("Index out of range");
+        return blockData(index / blockElements, false)[index % blockElements];
+    }
+
+    //Call f(item) for every element in order, one block at a time
+    template <typename Function>
+    void forEach(Function f) const
+    {
+        for(size_type first = 0; first < size; first += blockElements)
+        {
+            const Type* data = blockData(first / blockElements, false);
+            const size_type count = std::min(blockElements, size - first);
+            for(size_type i = 0; i < count; ++i)
+                f(data[i]);
+        }
+    }
+
+    //External merge sort: runs that fit in the memory budget are sorted in memory and
+    //written to a temporary file, then all runs are merged in one pass
+    template <typename Compare>
+    void sort(Compare comp)
+    {
+        if(size < 2) return;
+        flushCache();
+        const size_type runElements = std::max(blockElements, maxSlots * blockElements);
+        std::unique_ptr<Type[]> buffer(new Type[std::min(size, runElements)]);
+
+        if(size <= runElements)
+        {
+            readRange(buffer.get(), 0, size);
+            std::sort(buffer.get(), buffer.get() + size, comp);
+            file.write(buffer.get(), size * sizeof(Type), 0);
+            storedBlocks = std::max(storedBlocks, (size + blockElements - 1) / blockElements);
+            return;
+        }
+
+        //Runs keep the positions of their elements, so run i starts at i * runElements in both files
+        external::TemporaryFile runs(directory);
+        std::vector<RunCursor> cursors;
+        for(size_type first = 0; first < size; first += runElements)
+        {
+            const size_type count = std::min(runElements, size - first);
+            readRange(buffer.get(), first, count);
+            std::sort(buffer.get(), buffer.get() + count, comp);
+            runs.write(buffer.get(), count * sizeof(Type), static_cast<std::uint64_t>(first) * sizeof(Type));
+            RunCursor cursor;
+            cursor.next = first;
+            cursor.end = first + count;
+            cursor.position = cursor.buffered = 0;
+            cursors.push_back(std::move(cursor));
+        }
+        buffer.reset();
+
+        //The budget is shared by one input buffer per run and the output buffer
+        const size_type mergeElements = std::max<size_type>(1, runElements / (cursors.size() + 1));
+        auto refill = [&](RunCursor& cursor)
+        {
+            cursor.buffered = static_cast<size_type>(std::min<std::uint64_t>(mergeElements, cursor.end - cursor.next));
+            runs.read(cursor.buffer.get(), cursor.buffered * sizeof(Type), cursor.next * sizeof(Type));
+            cursor.next += cursor.buffered;
+            cursor.position = 0;
+        };
+        for(RunCursor& cursor : cursors)
+        {
+            cursor.buffer.reset(new Type[mergeElements]);
+            refill(cursor);
+        }
+
+        //Min-heap of run indices ordered by their current elements
+        auto later = [&](size_type a, size_type b)
+        {
+            return comp(cursors[b].buffer[cursors[b].position], cursors[a].buffer[cursors[a].position]);
+        };
+        std::vector<size_type> heap;
+        for(size_type i = 0; i < cursors.size(); ++i)
+            heap.push_back(i);
+        std::make_heap(heap.begin(), heap.end(), later);
+
+        std::unique_ptr<Type[]> output(new Type[mergeElements]);
+        size_type buffered = 0;
+        std::uint64_t written = 0;
+        while(!heap.empty())
+        {
+            std::pop_heap(heap.begin(), heap.end(), later);
+            RunCursor& cursor = cursors[heap.back()];
+            output[buffered++] = cursor.buffer[cursor.position++];
+            if(buffered == mergeElements)
+            {
+                file.write(output.get(), buffered * sizeof(Type), written * sizeof(Type));
+                written += buffered;
+                buffered = 0;
+            }
+            if(cursor.position == cursor.buffered && cursor.next < cursor.end) refill(cursor);
+            if(cursor.position < cursor.buffered) std::push_heap(heap.begin(), heap.end(), later);
+            else heap.pop_back();
+        }
+        file.write(output.get(), buffered * sizeof(Type), written * sizeof(Type));
+        storedBlocks = std::max(storedBlocks, (size + blockElements - 1) / blockElements);
+    }
+
+    void sort()
+    {
+        sort(std::less<Type>());
+    }
+
+    iterator begin()
+    {
+        return iterator(const_iterator(this, 0));
+    }
+
+    iterator end()
+    {
+        return iterator(const_iterator(this, size));
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(this, size);
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+};
+
+template <typename Type>
+const typename ExternalVector<Type>::size_type ExternalVector<Type>::DEFAULT_BLOCK_BYTES;
+
+template <typename Type>
+const typename ExternalVector<Type>::size_type ExternalVector<Type>::READ_AHEAD_BLOCKS;
+
+template <typename Type>
+const typename ExternalVector<Type>::size_type ExternalVector<Type>::NO_SLOT;
+
+//Writable view of a single element: reading it keeps the block clean, assigning marks it dirty
+template <typename Type>
+class ExternalVector<Type>::Reference
+{
+private:
+    ExternalVector<Type>* parent_vec;
+    size_type index;
+
+public:
+    Reference(ExternalVector<Type>* parent, size_type i) : parent_vec(parent), index(i)
+    {}
+
+    operator Type() const
+    {
+        const ExternalVector<Type>& parent = *parent_vec;
+        return parent[index];
+    }
+
+    Reference& operator=(const Type& value)
+    {
+        parent_vec->blockData(index / parent_vec->blockElements, true)[index % parent_vec->blockElements] = value;
+        return *this;
+    }
+
+    Reference& operator=(const Reference& other)
+    {
+        return *this = static_cast<Type>(other);
+    }
+};
+
+//Iterators hold indices and go through the block cache on every dereference
+template <typename Type>
+class ExternalVector<Type>::ConstIterator
+{
+public:
+    friend class ExternalVector<Type>;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename ExternalVector::value_type;
+    using difference_type = typename ExternalVector::difference_type;
+    using pointer = typename ExternalVector::const_pointer;
+    using reference = typename ExternalVector::const_reference;
+
+protected:
+    const ExternalVector<Type>* parent_vec;
+    size_type index;
+
+public:
+    explicit ConstIterator() : parent_vec(nullptr), index(0)
+    {}
+
+    ConstIterator(const ExternalVector<Type>* parent, size_type i) : parent_vec(parent), index(i)
+    {}
+
+    reference operator*() const
+    {
+        if(index >= parent_vec->size) throw std::out_of_range("Iterator points at empty space after the last element");
+        return (*parent_vec)[index];
+    }
+
+    ConstIterator& operator++()
+    {
+        if(index >= parent_vec->size) throw std::out_of_range("Cannot increment iterator");
+        ++index;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    ConstIterator& operator--()
+    {
+        if(index == 0) throw std::out_of_range("Cannot decrement iterator");
+        --index;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        return ConstIterator(parent_vec, index + d);
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        return ConstIterator(parent_vec, index - d);
+    }
+
+    bool operator==(const ConstIterator& other) const
+    {
+        return parent_vec == other.parent_vec && index == other.index;
+    }
+
+    bool operator!=(const ConstIterator& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+template <typename Type>
+class ExternalVector<Type>::Iterator : public ExternalVector<Type>::ConstIterator
+{
+public:
+    using pointer = void;
+    using reference = typename ExternalVector::reference;
+
+    explicit Iterator()
+    {}
+
+    Iterator(const ConstIterator& other) : ConstIterator(other)
+    {}
+
+    Iterator& operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator& operator--()
+    {
+        ConstIterator::operator--();
+        return *this;
+    }
+
+    Iterator operator--(int)
+    {
+        auto result = *this;
+        ConstIterator::operator--();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    Iterator operator-(difference_type d) const
+    {
+        return ConstIterator::operator-(d);
+    }
+
+    reference operator*() const
+    {
+        ConstIterator::operator*(); //bounds check
+        return Reference(const_cast<ExternalVector*>(this->parent_vec), this->index);
+    }
+};
+
+}
+
+#endif // AISDI_LINEAR_EXTERNALVECTOR_H
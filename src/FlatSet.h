@@ -0,0 +1,421 @@
+#ifndef AISDI_LINEAR_FLATSET_H
+#define AISDI_LINEAR_FLATSET_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "BitOps.h"
+#include "Span.h"
+#include "Vector.h"
+
+namespace aisdi
+{
+
+//How lookups search the sorted entries
+enum class SearchLayout
+{
+    Sorted, //Branch-free binary search straight over the sorted entries, no extra memory
+    Eytzinger //Search over a copy of the keys in breadth-first order, cache friendly on large sets
+};
+
+namespace detail
+{
+
+template <typename Type>
+struct Identity
+{
+    const Type& operator()(const Type& value) const
+    {
+        return value;
+    }
+};
+
+template <typename Pair>
+struct First
+{
+    const typename Pair::first_type& operator()(const Pair& value) const
+    {
+        return value.first;
+    }
+};
+
+//Entries kept sorted and unique in a Vector. Insertions go to an unsorted buffer that is
+//sorted and merged in a single pass by flush(), so bulk insertion costs O((n + k) + k log k)
+//instead of O(n) per key. Lookups on a non-const container flush first. Const lookups never
+//modify the container, so they may run concurrently, and they throw std::logic_error while
+//insertions are pending. The Eytzinger layout is also rebuilt by flush(); until then, e.g.
+//after an erase, const lookups search the sorted entries.
+template <typename Entry, typename Key, typename KeyOf, typename Compare>
+class SortedStorage
+{
+public:
+    using size_type = std::size_t;
+    using value_type = Entry;
+    using const_iterator = typename Vector<Entry>::const_iterator;
+
+    static const size_type EYTZINGER_THRESHOLD = 64; //Smaller sets are always searched in place
+
+protected:
+    Vector<Entry> entries;
+    Vector<Entry> pending; //Inserted, not yet merged; earlier ones win among equal keys
+    Vector<Key> layout; //Keys in Eytzinger order, layout[0] is unused
+    Vector<size_type> ranks; //Index in *entries* of every key in *layout*
+    bool layoutValid;
+    SearchLayout searchLayout;
+    Compare less;
+    KeyOf keyOf;
+
+    explicit SortedStorage(SearchLayout l) : layoutValid(false), searchLayout(l)
+    {}
+
+    bool equal(const Key& a, const Key& b) const
+    {
+        return !less(a, b) && !less(b, a);
+    }
+
+    const SortedStorage& constThis() const
+    {
+        return *this;
+    }
+
+    void checkFlushed() const
+    {
+        if(!pending.isEmpty()) throw std::logic_error("Pending insertions have to be flushed first");
+    }
+
+    bool usesLayout() const
+    {
+        return searchLayout == SearchLayout::Eytzinger && entries.getSize() >= EYTZINGER_THRESHOLD;
+    }
+
+    size_type fillLayout(size_type i, size_type k)
+    {
+        if(k >= layout.getSize()) return i;
+        i = fillLayout(i, 2 * k);
+        layout.data()[k] = keyOf(entries.data()[i]);
+        ranks.data()[k] = i++;
+        return fillLayout(i, 2 * k + 1);
+    }
+
+    size_type sortedLowerBound(const Key& key) const
+    {
+        const Entry* data = entries.data();
+        const Entry* base = data;
+        size_type n = entries.getSize();
+        if(n == 0) return 0;
+        while(n > 1)
+        {
+            const size_type half = n / 2;
+            base = less(keyOf(base[half - 1]), key) ? base + half : base;
+            n -= half;
+        }
+        return (base - data) + less(keyOf(*base), key);
+    }
+
+    size_type eytzingerLowerBound(const Key& key) const
+    {
+        const size_type n = entries.getSize();
+        const Key* keys = layout.data();
+        std::uint64_t k = 1;
+        while(k <= n)
+        {
+#if defined(__GNUC__)
+            __builtin_prefetch(keys + 16 * k);
+#endif
+            k = 2 * k + less(keys[k], key);
+        }
+        k >>= bits::countTrailingZeros(~k) + 1;
+        return k == 0 ? n : ranks.data()[k];
+    }
+
+    //Index of the first entry not less than *key*
+    size_type lowerBound(const Key& key) const
+    {
+        checkFlushed();
+        if(layoutValid && usesLayout()) return eytzingerLowerBound(key);
+        return sortedLowerBound(key);
+    }
+
+    //Index of the entry with *key*, or the entry count when there is none
+    size_type indexOf(const Key& key) const
+    {
+        const size_type i = lowerBound(key);
+        return i < entries.getSize() && !less(key, keyOf(entries.data()[i])) ? i : entries.getSize();
+    }
+
+    void mergePending()
+    {
+        Entry* first = pending.data();
+        Entry* last = first + pending.getSize();
+        std::stable_sort(first, last, [this](const Entry& a, const Entry& b) { return less(keyOf(a), keyOf(b)); });
+
+        Vector<Entry> merged;
+        merged.resize(entries.getSize() + pending.getSize());
+        const Entry* a = entries.data();
+        const Entry* aEnd = a + entries.getSize();
+        Entry* out = merged.data();
+        for(const Entry* b = first; b != last;)
+        {
+            if(a != aEnd && !less(keyOf(*b), keyOf(*a)))
+            {
+                if(less(keyOf(*a), keyOf(*b))) *out++ = *a++;
+                else ++b; //Already present
+                continue;
+            }
+            *out++ = *b;
+            const Entry* added = b++;
+            while(b != last && equal(keyOf(*b), keyOf(*added)))
+                ++b;
+        }
+        out = std::copy(a, aEnd, out);
+        merged.resize(out - merged.data());
+        swap(entries, merged);
+        pending.resize(0);
+        layoutValid = false;
+    }
+
+public:
+    //Sort the pending insertions and merge them into the entries, then rebuild the search layout
+    void flush()
+    {
+        if(!pending.isEmpty()) mergePending();
+        if(layoutValid || !usesLayout()) return;
+        layout.resize(entries.getSize() + 1);
+        ranks.resize(entries.getSize() + 1);
+        fillLayout(0, 1);
+        layoutValid = true;
+    }
+
+    //True while inserted keys wait for flush()
+    bool hasPending() const
+    {
+        return !pending.isEmpty();
+    }
+
+    bool isEmpty() const
+    {
+        return getSize() == 0;
+    }
+
+    bool isEmpty()
+    {
+        return getSize() == 0;
+    }
+
+    size_type getSize() const
+    {
+        checkFlushed();
+        return entries.getSize();
+    }
+
+    size_type getSize()
+    {
+        flush();
+        return entries.getSize();
+    }
+
+    SearchLayout getSearchLayout() const
+    {
+        return searchLayout;
+    }
+
+    bool contains(const Key& key) const
+    {
+        return indexOf(key) != entries.getSize();
+    }
+
+    bool contains(const Key& key)
+    {
+        flush();
+        return constThis().contains(key);
+    }
+
+    //Remove the entry with *key*; returns false when there was none
+    bool erase(const Key& key)
+    {
+        flush();
+        const size_type i = indexOf(key);
+        if(i == entries.getSize()) return false;
+        entries.erase(entries.cbegin() + i);
+        layoutValid = false;
+        return true;
+    }
+
+    //Entries with keys in [low, high)
+    Span<const Entry> range(const Key& low, const Key& high) const
+    {
+        const size_type first = lowerBound(low);
+        const size_type last = std::max(first, lowerBound(high));
+        return Span<const Entry>(entries.data() + first, last - first);
+    }
+
+    Span<const Entry> range(const Key& low, const Key& high)
+    {
+        flush();
+        return constThis().range(low, high);
+    }
+
+    //Entries in key order
+    Span<const Entry> getEntries() const
+    {
+        checkFlushed();
+        return Span<const Entry>(entries.data(), entries.getSize());
+    }
+
+    Span<const Entry> getEntries()
+    {
+        flush();
+        return constThis().getEntries();
+    }
+
+    const_iterator cbegin() const
+    {
+        checkFlushed();
+        return entries.cbegin();
+    }
+
+    const_iterator cend() const
+    {
+        checkFlushed();
+        return entries.cend();
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+
+    const_iterator begin()
+    {
+        flush();
+        return cbegin();
+    }
+
+    const_iterator end()
+    {
+        flush();
+        return cend();
+    }
+};
+
+template <typename Entry, typename Key, typename KeyOf, typename Compare>
+const typename SortedStorage<Entry, Key, KeyOf, Compare>::size_type
+SortedStorage<Entry, Key, KeyOf, Compare>::EYTZINGER_THRESHOLD;
+
+}
+
+//Ordered set of unique keys stored contiguously
+template <typename Key, typename Compare = std::less<Key>>
+class FlatSet : public detail::SortedStorage<Key, Key, detail::Identity<Key>, Compare>
+{
+    using Base = detail::SortedStorage<Key, Key, detail::Identity<Key>, Compare>;
+
+public:
+    using key_type = Key;
+
+    explicit FlatSet(SearchLayout l = SearchLayout::Sorted) : Base(l)
+    {}
+
+    FlatSet(std::initializer_list<Key> l) : Base(SearchLayout::Sorted)
+    {
+        for(const Key& key : l)
+            insert(key);
+        this->flush();
+    }
+
+    //Buffered: the key is merged in by the next flush, duplicates are ignored
+    void insert(const Key& key)
+    {
+        this->pending.append(key);
+    }
+
+    //The stored key equal to *key*, or nullptr
+    const Key* find(const Key& key) const
+    {
+        const std::size_t i = this->indexOf(key);
+        return i == this->entries.getSize() ? nullptr : this->entries.data() + i;
+    }
+
+    const Key* find(const Key& key)
+    {
+        this->flush();
+        return static_cast<const FlatSet&>(*this).find(key);
+    }
+};
+
+//Ordered map with unique keys stored contiguously as (key, value) pairs
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class FlatMap : public detail::SortedStorage<std::pair<Key, Value>, Key, detail::First<std::pair<Key, Value>>, Compare>
+{
+    using Base = detail::SortedStorage<std::pair<Key, Value>, Key, detail::First<std::pair<Key, Value>>, Compare>;
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+
+    explicit FlatMap(SearchLayout l = SearchLayout::Sorted) : Base(l)
+    {}
+
+    FlatMap(std::initializer_list<std::pair<Key, Value>> l) : Base(SearchLayout::Sorted)
+    {
+        for(const auto& entry : l)
+            insert(entry.first, entry.second);
+        this->flush();
+    }
+
+    //Buffered: merged in by the next flush. Like std::map::insert, an existing key keeps
+    //its value, and among pending insertions of one key the first one wins
+    void insert(const Key& key, const Value& value)
+    {
+        this->pending.append(std::pair<Key, Value>(key, value));
+    }
+
+    //Set the value of *key*, adding the key when it is missing
+    void assign(const Key& key, const Value& value)
+    {
+        Value* current = find(key);
+        if(current) *current = value;
+        else insert(key, value);
+    }
+
+    Value* find(const Key& key)
+    {
+        this->flush();
+        const std::size_t i = this->indexOf(key);
+        return i == this->entries.getSize() ? nullptr : &this->entries.data()[i].second;
+    }
+
+    const Value* find(const Key& key) const
+    {
+        const std::size_t i = this->indexOf(key);
+        return i == this->entries.getSize() ? nullptr : &this->entries.data()[i].second;
+    }
+
+    Value& at(const Key& key)
+    {
+        Value* value = find(key);
+        if(!value) throw std::out_of_range("Key not found");
+        return *value;
+    }
+
+    const Value& at(const Key& key) const
+    {
+        const Value* value = find(key);
+        if(!value) throw std::out_of_range("Key not found");
+        return *value;
+    }
+};
+
+}
+
+#endif // AISDI_LINEAR_FLATSET_H
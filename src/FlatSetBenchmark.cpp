@@ -0,0 +1,147 @@
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "FlatSet.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+
+std::vector<int> randomKeys(std::size_t count, unsigned seed)
+{
+    std::vector<int> keys(count);
+    for(int& key : keys)
+    {
+        seed = seed * 1103515245u + 12345u;
+        key = static_cast<int>(seed >> 1);
+    }
+    return keys;
+}
+
+void printRow(const std::string& name, double insertMs, double findMs, double scanMs)
+{
+    std::cout << std::left << std::setw(22) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << insertMs << std::setw(10) << findMs << std::setw(10) << scanMs << std::endl;
+}
+
+template <typename Set>
+void measureFlat(const std::string& name, Set& set, const std::vector<int>& keys, const std::vector<int>& probes)
+{
+    std::size_t found = 0;
+    long sum = 0;
+    const double insertMs = measureMs([&]
+    {
+        for(int key : keys)
+            set.insert(key);
+        set.flush();
+    });
+    const double findMs = measureMs([&]
+    {
+        for(int probe : probes)
+            found += set.contains(probe);
+    });
+    const double scanMs = measureMs([&]
+    {
+        for(int key : set.getEntries())
+            sum += key;
+    });
+    printRow(name, insertMs, findMs, scanMs);
+    if(found == probes.size() + 1 || sum == 1) std::cout << std::endl;
+}
+
+void perfomTest(std::size_t size, std::size_t lookups)
+{
+    const std::vector<int> keys = randomKeys(size, 2016);
+    std::vector<int> probes = randomKeys(lookups / 2, 7);
+    for(std::size_t i = 0; probes.size() < lookups; i += 7)
+        probes.push_back(keys[i % keys.size()]);
+
+    std::cout << size << " random int keys, " << lookups << " lookups (half present)" << std::endl
+              << std::left << std::setw(22) << "" << std::right << std::setw(10) << "insert" << std::setw(10) << "find"
+              << std::setw(10) << "scan" << "   [ms]" << std::endl;
+
+    {
+        std::set<int> set;
+        std::size_t found = 0;
+        long sum = 0;
+        const double insertMs = measureMs([&]
+        {
+            for(int key : keys)
+                set.insert(key);
+        });
+        const double findMs = measureMs([&]
+        {
+            for(int probe : probes)
+                found += set.count(probe);
+        });
+        const double scanMs = measureMs([&]
+        {
+            for(int key : set)
+                sum += key;
+        });
+        printRow("std::set", insertMs, findMs, scanMs);
+        if(found == probes.size() + 1 || sum == 1) std::cout << std::endl;
+    }
+
+    aisdi::FlatSet<int> sorted(aisdi::SearchLayout::Sorted);
+    measureFlat("FlatSet (sorted)", sorted, keys, probes);
+    aisdi::FlatSet<int> eytzinger(aisdi::SearchLayout::Eytzinger);
+    measureFlat("FlatSet (Eytzinger)", eytzinger, keys, probes);
+
+    {
+        std::map<int, int> map;
+        aisdi::FlatMap<int, int> flat;
+        long sum = 0;
+        const double stdInsertMs = measureMs([&]
+        {
+            for(int key : keys)
+                map.insert(std::make_pair(key, key / 2));
+        });
+        const double stdFindMs = measureMs([&]
+        {
+            for(int probe : probes)
+            {
+                auto it = map.find(probe);
+                if(it != map.end()) sum += it->second;
+            }
+        });
+        const double flatInsertMs = measureMs([&]
+        {
+            for(int key : keys)
+                flat.insert(key, key / 2);
+            flat.flush();
+        });
+        const double flatFindMs = measureMs([&]
+        {
+            for(int probe : probes)
+            {
+                const int* value = flat.find(probe);
+                if(value) sum -= *value;
+            }
+        });
+        printRow("std::map", stdInsertMs, stdFindMs, 0);
+        printRow("FlatMap (sorted)", flatInsertMs, flatFindMs, 0);
+        if(sum != 0) std::cout << "Results differ!" << std::endl;
+    }
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const std::size_t size = argc > 1 ? std::atoll(argv[1]) : 1000000;
+    const std::size_t lookups = argc > 2 ? std::atoll(argv[2]) : 1000000;
+
+    perfomTest(size, lookups);
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
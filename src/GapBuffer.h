@@ -0,0 +1,411 @@
+#ifndef AISDI_LINEAR_GAPBUFFER_H
+#define AISDI_LINEAR_GAPBUFFER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+
+namespace aisdi
+{
+
+//Vector with an unused gap kept inside the storage instead of at its end. Elements before
+//the gap sit at the front of the buffer and elements after it at the back, so inserting or
+//erasing at the gap costs O(1). The gap only moves when an edit happens somewhere else,
+//and then by copying just the elements between its old and new position, so edits around
+//a slowly moving cursor are O(1) amortized instead of shifting the whole tail.
+//Iterators hold logical indices and, as in Vector, are invalidated by insert and erase.
+template <typename Type>
+class GapBuffer
+{
+public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type*;
+    using reference = Type&;
+    using const_pointer = const Type*;
+    using const_reference = const Type&;
+
+    class ConstIterator;
+    class Iterator;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+    static const size_type MIN_GAP = 16; //Smallest gap left after a reallocation
+
+private:
+    value_type *items;
+    size_type capacity;
+    size_type gapStart; //Logical index of the first element after the gap
+    size_type gapEnd; //Physical position of that element
+    const double INCREASE_FACTOR = 0.5; //Factor by which the capacity will be increased when reallocation is needed
+
+    size_type gapSize() const
+    {
+        return gapEnd - gapStart;
+    }
+
+    size_type physical(size_type index) const
+    {
+        return index < gapStart ? index : index + gapSize();
+    }
+
+    //Put the gap right before the element at *index*
+    void moveGap(size_type index)
+    {
+        if(index < gapStart)
+        {
+            std::copy_backward(items + index, items + gapStart, items + gapEnd);
+            gapEnd -= gapStart - index;
+            gapStart = index;
+        }
+        else if(index > gapStart)
+        {
+            std::copy(items + gapEnd, items + gapEnd + (index - gapStart), items + gapStart);
+            gapEnd += index - gapStart;
+            gapStart = index;
+        }
+    }
+
+    //Move the elements to a buffer of *newCapacity*, keeping the gap where it is
+    void reallocate(size_type newCapacity)
+    {
+        value_type *new_space = new value_type[newCapacity];
+        const size_type after = capacity - gapEnd;
+        std::copy(items, items + gapStart, new_space);
+        std::copy(items + gapEnd, items + capacity, new_space + newCapacity - after);
+        delete[] items;
+        items = new_space;
+        capacity = newCapacity;
+        gapEnd = newCapacity - after;
+    }
+
+public:
+    GapBuffer() : items(nullptr), capacity(0), gapStart(0), gapEnd(0)
+    {}
+
+    GapBuffer(std::initializer_list<Type> l) : items(l.size() ? new value_type[l.size()] : nullptr),
+                    capacity(l.size()), gapStart(l.size()), gapEnd(l.size())
+    {
+        std::copy(l.begin(), l.end(), items);
+    }
+
+    //The copy gets its elements in one block, with the gap at the end
+    GapBuffer(const GapBuffer& other) : items(other.getSize() ? new value_type[other.getSize()] : nullptr),
+                    capacity(other.getSize()), gapStart(capacity), gapEnd(capacity)
+    {
+        std::copy(other.items, other.items + other.gapStart, items);
+        std::copy(other.items + other.gapEnd, other.items + other.capacity, items + other.gapStart);
+    }
+
+    GapBuffer(GapBuffer&& other) : items(other.items), capacity(other.capacity), gapStart(other.gapStart),
+                    gapEnd(other.gapEnd)
+    {
+        other.items = nullptr;
+        other.capacity = other.gapStart = other.gapEnd = 0;
+    }
+
+    ~GapBuffer()
+    {
+        delete[] items;
+    }
+
+    friend void swap(GapBuffer& first, GapBuffer& second)
+    {
+        using std::swap;
+        swap(first.items, second.items);
+        swap(first.capacity, second.capacity);
+        swap(first.gapStart, second.gapStart);
+        swap(first.gapEnd, second.gapEnd);
+    }
+
+    GapBuffer& operator=(GapBuffer other)
+    {
+        swap(*this, other);
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return getSize() == 0;
+    }
+
+    size_type getSize() const
+    {
+        return capacity - gapSize();
+    }
+
+    size_type getCapacity() const
+    {
+        return capacity;
+    }
+
+    //Logical index of the gap, i.e. of the element that follows it
+    size_type getGapPosition() const
+    {
+        return gapStart;
+    }
+
+    reference operator[](size_type index)
+    {
+        if(index >= getSize()) throw std::out_of_range("Index out of range");
+        return items[physical(index)];
+    }
+
+    const_reference operator[](size_type index) const
+    {
+        if(index >= getSize()) throw std::out_of_range("Index out of range");
+        return items[physical(index)];
+    }
+
+    //Make sure there is space for at least *newCapacity* elements
+    void reserve(size_type newCapacity)
+    {
+        if(newCapacity > capacity) reallocate(newCapacity);
+    }
+
+    //Call f(item) for every element in order, as two contiguous runs around the gap
+    template <typename Function>
+    void forEach(Function f) const
+    {
+        std::for_each(items, items + gapStart, f);
+        std::for_each(items + gapEnd, items + capacity, f);
+    }
+
+    void append(const Type& item)
+    {
+        insert(cend(), item);
+    }
+
+    void prepend(const Type& item)
+    {
+        insert(cbegin(), item);
+    }
+
+    void insert(const const_iterator& insertPosition, const Type& item)
+    {
+        const size_type index = insertPosition.index;
+        if(index > getSize()) throw std::out_of_range("Cannot insert outside of the vector");
+        const value_type copy = item; //*item* may be moved along with the gap
+        if(gapSize() == 0)
+            reallocate(std::max<size_type>(capacity * (1 + INCREASE_FACTOR), capacity + MIN_GAP));
+        moveGap(index);
+        items[gapStart++] = copy;
+    }
+
+    value_type popFirst()
+    {
+        if(isEmpty()) throw std::logic_error("Vector is empty");
+        value_type temp = *cbegin();
+        erase(cbegin());
+        return temp;
+    }
+
+    value_type popLast()
+    {
+        if(isEmpty()) throw std::logic_error("Vector is empty");
+        value_type temp = *(cend() - 1);
+        erase(cend() - 1);
+        return temp;
+    }
+
+    void erase(const const_iterator& possition)
+    {
+        erase(possition, possition + 1);
+    }
+
+    //Widen the gap over [firstIncluded, lastExcluded), moving it from whichever end of the
+    //range is closer, so both backspace (range ends at the gap) and delete (range starts
+    //at the gap) move no elements
+    void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded)
+    {
+        if(isEmpty()) throw std::out_of_range("Vector is empty");
+        const size_type first = firstIncluded.index;
+        const size_type last = lastExcluded.index;
+        if(last < first || last > getSize()) throw std::out_of_range("firstIncluded should be before lastExcluded");
+        const size_type toFirst = first > gapStart ? first - gapStart : gapStart - first;
+        const size_type toLast = last > gapStart ? last - gapStart : gapStart - last;
+        if(toLast < toFirst)
+        {
+            moveGap(last);
+            gapStart = first;
+        }
+        else
+        {
+            moveGap(first);
+            gapEnd += last - first;
+        }
+    }
+
+    iterator begin()
+    {
+        return iterator(cbegin());
+    }
+
+    iterator end()
+    {
+        return iterator(cend());
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(this, getSize());
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+};
+
+template <typename Type>
+const typename GapBuffer<Type>::size_type GapBuffer<Type>::MIN_GAP;
+
+template <typename Type>
+class GapBuffer<Type>::ConstIterator
+{
+public:
+    friend class GapBuffer<Type>;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename GapBuffer::value_type;
+    using difference_type = typename GapBuffer::difference_type;
+    using pointer = typename GapBuffer::const_pointer;
+    using reference = typename GapBuffer::const_reference;
+
+protected:
+    const GapBuffer<Type>* parent_vec;
+    size_type index;
+
+public:
+    explicit ConstIterator() : parent_vec(nullptr), index(0)
+    {}
+
+    ConstIterator(const GapBuffer<Type>* parent, size_type i) : parent_vec(parent), index(i)
+    {}
+
+    reference operator*() const
+    {
+        if(index >= parent_vec->getSize()) throw std::out_of_range("Iterator points at empty space after the last element");
+        return parent_vec->items[parent_vec->physical(index)];
+    }
+
+    ConstIterator& operator++()
+    {
+        if(index >= parent_vec->getSize()) throw std::out_of_range("Cannot increment iterator");
+        ++index;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    ConstIterator& operator--()
+    {
+        if(index == 0) throw std::out_of_range("Cannot decrement iterator");
+        --index;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        return ConstIterator(parent_vec, index + d);
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        return ConstIterator(parent_vec, index - d);
+    }
+
+    bool operator==(const ConstIterator& other) const
+    {
+        return parent_vec == other.parent_vec && index == other.index;
+    }
+
+    bool operator!=(const ConstIterator& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+template <typename Type>
+class GapBuffer<Type>::Iterator : public GapBuffer<Type>::ConstIterator
+{
+public:
+    using pointer = typename GapBuffer::pointer;
+    using reference = typename GapBuffer::reference;
+
+    explicit Iterator()
+    {}
+
+    Iterator(const ConstIterator& other) : ConstIterator(other)
+    {}
+
+    Iterator& operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator& operator--()
+    {
+        ConstIterator::operator--();
+        return *this;
+    }
+
+    Iterator operator--(int)
+    {
+        auto result = *this;
+        ConstIterator::operator--();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    Iterator operator-(difference_type d) const
+    {
+        return ConstIterator::operator-(d);
+    }
+
+    reference operator*() const
+    {
+        // ugly cast, yet reduces code duplication.
+        return const_cast<reference>(ConstIterator::operator*());
+    }
+};
+
+}
+
+#endif // AISDI_LINEAR_GAPBUFFER_H
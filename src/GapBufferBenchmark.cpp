@@ -0,0 +1,141 @@
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "GapBuffer.h"
+#include "LinkedList.h"
+#include "Vector.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+
+//One step of a recorded editing session
+struct Edit
+{
+    enum Kind { Type, Backspace, Move } kind;
+    int value; //Typed character or cursor offset
+};
+
+//Mostly typing, some backspaces, and cursor moves that are usually short and sometimes jump
+std::vector<Edit> makeTrace(std::size_t edits)
+{
+    std::vector<Edit> trace;
+    trace.reserve(edits);
+    unsigned seed = 2016;
+    for(std::size_t i = 0; i < edits; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        const unsigned roll = (seed >> 8) % 100;
+        if(roll < 75) trace.push_back(Edit{ Edit::Type, static_cast<int>('a' + (seed >> 16) % 26) });
+        else if(roll < 90) trace.push_back(Edit{ Edit::Backspace, 0 });
+        else if(roll < 99) trace.push_back(Edit{ Edit::Move, static_cast<int>((seed >> 16) % 17) - 8 });
+        else trace.push_back(Edit{ Edit::Move, static_cast<int>((seed >> 12) % 20001) - 10000 });
+    }
+    return trace;
+}
+
+std::size_t clampCursor(std::size_t cursor, int offset, std::size_t size)
+{
+    if(offset < 0 && static_cast<std::size_t>(-offset) > cursor) return 0;
+    return std::min(cursor + offset, size);
+}
+
+//Vector and GapBuffer address the cursor by index
+template <typename Collection>
+long replayIndexed(Collection& text, const std::vector<Edit>& trace)
+{
+    std::size_t cursor = text.getSize() / 2;
+    for(const Edit& edit : trace)
+    {
+        if(edit.kind == Edit::Type) text.insert(text.begin() + cursor++, static_cast<char>(edit.value));
+        else if(edit.kind == Edit::Backspace && cursor > 0) text.erase(text.begin() + --cursor);
+        else if(edit.kind == Edit::Move) cursor = clampCursor(cursor, edit.value, text.getSize());
+    }
+    long checksum = 0;
+    for(auto it = text.begin(); it != text.end(); ++it)
+        checksum = checksum * 31 + *it;
+    return checksum;
+}
+
+//LinkedList keeps an iterator at the cursor and walks it, positional access would be O(n)
+long replayList(aisdi::LinkedList<char>& text, const std::vector<Edit>& trace)
+{
+    std::size_t cursor = text.getSize() / 2, size = text.getSize();
+    auto position = text.begin() + cursor;
+    for(const Edit& edit : trace)
+    {
+        if(edit.kind == Edit::Type)
+        {
+            text.insert(position, static_cast<char>(edit.value));
+            ++cursor;
+            ++size;
+        }
+        else if(edit.kind == Edit::Backspace && cursor > 0)
+        {
+            text.erase(position - 1);
+            --cursor;
+            --size;
+        }
+        else if(edit.kind == Edit::Move)
+        {
+            const std::size_t target = clampCursor(cursor, edit.value, size);
+            for(; cursor < target; ++cursor)
+                ++position;
+            for(; cursor > target; --cursor)
+                --position;
+        }
+    }
+    long checksum = 0;
+    for(auto it = text.begin(); it != text.end(); ++it)
+        checksum = checksum * 31 + *it;
+    return checksum;
+}
+
+template <typename Collection>
+void fill(Collection& text, std::size_t size)
+{
+    for(std::size_t i = 0; i < size; ++i)
+        text.append(static_cast<char>('a' + i % 26));
+}
+
+void perfomTest(std::size_t documentSize, std::size_t edits)
+{
+    const std::vector<Edit> trace = makeTrace(edits);
+
+    aisdi::Vector<char> vector;
+    aisdi::LinkedList<char> list;
+    aisdi::GapBuffer<char> gap;
+    fill(vector, documentSize);
+    fill(list, documentSize);
+    fill(gap, documentSize);
+
+    long vectorSum = 0, listSum = 0, gapSum = 0;
+    const double vectorMs = measureMs([&] { vectorSum = replayIndexed(vector, trace); });
+    const double listMs = measureMs([&] { listSum = replayList(list, trace); });
+    const double gapMs = measureMs([&] { gapSum = replayIndexed(gap, trace); });
+
+    std::cout << documentSize << " characters, " << edits << " edits" << std::endl
+              << std::fixed << std::setprecision(1)
+              << "Vector:     " << vectorMs << " ms" << std::endl
+              << "LinkedList: " << listMs << " ms" << std::endl
+              << "GapBuffer:  " << gapMs << " ms" << std::endl;
+    if(vectorSum != listSum || vectorSum != gapSum) std::cout << "Results differ!" << std::endl;
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const std::size_t documentSize = argc > 1 ? std::atoll(argv[1]) : 1000000;
+    const std::size_t edits = argc > 2 ? std::atoll(argv[2]) : 20000;
+
+    perfomTest(documentSize, edits);
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
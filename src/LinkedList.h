@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <initializer_list>
 #include <stdexcept>
+#include <vector>
 
 namespace aisdi
 {
@@ -132,6 +133,45 @@ public:
         return list_size;
     }
 
+    //Iterators dividing the list into at most *parts* ranges of nearly equal length, found in one pass.
+    //Every stride-th node is remembered; when the checkpoints fill up, every other one is dropped
+    //and the stride doubles, so memory stays O(parts). The result starts at begin() and ends at end().
+    std::vector<const_iterator> splitPoints(size_type parts) const
+    {
+        if(parts == 0) parts = 1;
+        const size_type maxCheckpoints = 8 * parts;
+        std::vector<node*> checkpoints;
+        checkpoints.reserve(maxCheckpoints);
+        size_type stride = 1, count = 0;
+        node *stop = cend().element;
+        for(node *nd = first; nd != stop; nd = nd->next, ++count)
+        {
+            if(count % stride != 0) continue;
+            if(checkpoints.size() == maxCheckpoints)
+            {
+                for(size_type i = 0; i < maxCheckpoints / 2; ++i)
+                    checkpoints[i] = checkpoints[2 * i];
+                checkpoints.resize(maxCheckpoints / 2);
+                stride *= 2;
+            }
+            checkpoints.push_back(nd);
+        }
+
+        std::vector<const_iterator> points(1, cbegin());
+        if(count < parts) parts = count > 0 ? count : 1;
+        size_type previous = 0;
+        for(size_type i = 1; i < parts; ++i)
+        {
+            size_type index = (i * count / parts + stride / 2) / stride;
+            if(index >= checkpoints.size()) index = checkpoints.size() - 1;
+            if(index <= previous) continue;
+            points.push_back(const_iterator(this, checkpoints[index]));
+            previous = index;
+        }
+        points.push_back(cend());
+        return points;
+    }
+
 private:
     void addFirstNode(node *nd)
     {
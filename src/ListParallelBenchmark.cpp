@@ -0,0 +1,49 @@
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "BenchmarkUtils.h"
+#include "ParallelAlgorithms.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+
+void perfomTest(std::size_t size, std::size_t maxThreads)
+{
+    aisdi::LinkedList<double> list;
+    for(std::size_t i = 0; i < size; ++i)
+        list.append(static_cast<double>(i % 100));
+
+    std::cout << "LinkedList<double>, " << size << " nodes" << std::endl;
+    std::cout << "split[ms] (" << aisdi::parallel::LIST_PARTS << " parts): " << std::fixed << std::setprecision(1)
+              << measureMs([&]{ list.splitPoints(aisdi::parallel::LIST_PARTS); }) << std::endl;
+    std::cout << "threads  forEach[ms]  reduce[ms]" << std::endl;
+
+    for(std::size_t threads = 1; threads <= maxThreads; ++threads)
+    {
+        aisdi::ThreadPool pool(threads);
+        double sum = 0;
+        double forEachMs = measureMs([&]{ aisdi::parallel::forEach(list, [](double& x){ x = x * 0.5 + 1; }, pool); });
+        double reduceMs = measureMs([&]{ sum = aisdi::parallel::reduce(list, 0.0, pool); });
+        std::cout << std::setw(7) << threads << std::setw(13) << forEachMs << std::setw(12) << reduceMs
+                  << "   (sum " << sum << ")" << std::endl;
+    }
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    //Node count grows tenfold from 1e6 up to the given limit (1e8 nodes need several GB of memory)
+    const std::size_t maxSize = argc > 1 ? std::atoll(argv[1]) : 100000000;
+    const std::size_t maxThreads = argc > 2 ? std::atoll(argv[2]) : aisdi::ThreadPool::defaultThreadCount();
+
+    for(std::size_t size = 1000000; size <= maxSize; size *= 10)
+        perfomTest(size, maxThreads);
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "BenchmarkUtils.h"
+#include "MappedVector.h"
+#include "Vector.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+
+void perfomTest(std::size_t size, const std::string& directory)
+{
+    const std::string textPath = directory + "/aisdi_values.txt";
+    const std::string mappedPath = directory + "/aisdi_values.bin";
+    std::remove(mappedPath.c_str());
+
+    {
+        std::ofstream text(textPath);
+        aisdi::MappedVector<double> mapped(mappedPath);
+        mapped.reserve(size);
+        for(std::size_t i = 0; i < size; ++i)
+        {
+            const double value = i * 0.25;
+            text << value << '\n';
+            mapped.append(value);
+        }
+    }
+
+    double textSum = 0, mappedSum = 0;
+    const double parseMs = measureMs([&]
+    {
+        aisdi::Vector<double> values;
+        std::ifstream text(textPath);
+        double value;
+        while(text >> value)
+            values.append(value);
+        for(double item : values)
+            textSum += item;
+    });
+    const double mapMs = measureMs([&]
+    {
+        const aisdi::MappedVector<double> values(mappedPath, aisdi::MappedVector<double>::OpenMode::ReadOnly);
+        values.advise(aisdi::MappedVector<double>::AccessPattern::Sequential);
+        const double* data = values.data();
+        for(std::size_t i = 0; i < values.getSize(); ++i)
+            mappedSum += data[i];
+    });
+
+    std::cout << size << " doubles, times in ms (sums " << textSum << ", " << mappedSum << ")" << std::endl
+              << std::fixed << std::setprecision(1)
+              << "text parse + append: " << parseMs << std::endl
+              << "map + scan:          " << mapMs << std::endl;
+
+    std::remove(textPath.c_str());
+    std::remove(mappedPath.c_str());
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const std::size_t size = argc > 1 ? std::atoll(argv[1]) : 10000000;
+    const std::string directory = argc > 2 ? argv[2] : "/tmp";
+
+    perfomTest(size, directory);
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
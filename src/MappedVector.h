@@ -0,0 +1,569 @@
+#ifndef AISDI_LINEAR_MAPPEDVECTOR_H
+#define AISDI_LINEAR_MAPPEDVECTOR_H
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace aisdi
+{
+
+//Vector of trivially copyable elements stored in a memory-mapped file. The file starts with
+//a small header (magic, element size, element count) followed by the elements, so opening
+//an existing file is a single mmap call with no parsing or copying.
+template <typename Type>
+class MappedVector
+{
+    static_assert(std::is_trivially_copyable<Type>::value, "MappedVector needs trivially copyable elements");
+
+public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type*;
+    using reference = Type&;
+    using const_pointer = const Type*;
+    using const_reference = const Type&;
+
+    class ConstIterator;
+    class Iterator;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+    enum class OpenMode
+    {
+        ReadWrite, //Open or create the file
+        ReadOnly   //Open an existing file, every mutation and writable element access throws std::logic_error;
+                   //use MappedVectorView to iterate such a file without going through const
+    };
+
+    enum class AccessPattern
+    {
+        Normal,
+        Sequential,
+        Random
+    };
+
+private:
+    struct Header
+    {
+        std::uint64_t magic;
+        std::uint64_t elementSize;
+        std::uint64_t size;
+    };
+
+    static const std::uint64_t MAGIC = 0x3156444D49534941ULL; //"AISIMDV1"
+    static const size_type HEADER_SIZE = 64; //Keeps the elements cache-line aligned
+
+    int fd;
+    bool readOnly;
+    char* mapping;
+    size_type mappedBytes;
+    size_type size; //Number of elements currently stored
+    size_type capacity; //Number of elements that fit in the mapped file
+    const double INCREASE_FACTOR = 0.5; //Factor by which the capacity will be increased when growing the file
+
+    static void fail(const char* what)
+    {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    Header* header() const
+    {
+        return reinterpret_cast<Header*>(mapping);
+    }
+
+    pointer elements() const
+    {
+        return reinterpret_cast<pointer>(mapping + HEADER_SIZE);
+    }
+
+    void checkWritable() const
+    {
+        if(readOnly) throw std::logic_error("Vector is read-only");
+    }
+
+    //Grow the file and the mapping so that *newCapacity* elements fit
+    void remap(size_type newCapacity)
+    {
+        const size_type bytes = HEADER_SIZE + newCapacity * sizeof(Type);
+        if(ftruncate(fd, static_cast<off_t>(bytes)) != 0) fail("ftruncate");
+#ifdef MREMAP_MAYMOVE
+        void* moved = mremap(mapping, mappedBytes, bytes, MREMAP_MAYMOVE);
+        if(moved == MAP_FAILED) fail("mremap");
+#else
+        void* moved = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if(moved == MAP_FAILED) fail("mmap");
+        munmap(mapping, mappedBytes);
+#endif
+        mapping = static_cast<char*>(moved);
+        mappedBytes = bytes;
+        capacity = newCapacity;
+    }
+
+    void release()
+    {
+        if(mapping)
+        {
+            if(!readOnly) header()->size = size;
+            munmap(mapping, mappedBytes);
+            mapping = nullptr;
+            if(!readOnly)
+            {
+                //Drop the spare capacity; if that fails the file just keeps it
+                int truncated = ftruncate(fd, static_cast<off_t>(HEADER_SIZE + size * sizeof(Type)));
+                static_cast<void>(truncated);
+            }
+        }
+        if(fd >= 0) close(fd);
+        fd = -1;
+    }
+
+public:
+    explicit MappedVector(const std::string& path, OpenMode mode = OpenMode::ReadWrite)
+            : fd(-1), readOnly(mode == OpenMode::ReadOnly), mapping(nullptr), mappedBytes(0), size(0), capacity(0)
+    {
+        fd = readOnly ? open(path.c_str(), O_RDONLY) : open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if(fd < 0) fail("open");
+
+        struct stat info;
+        if(fstat(fd, &info) != 0)
+        {
+            close(fd);
+            fail("fstat");
+        }
+        size_type fileBytes = static_cast<size_type>(info.st_size);
+        const bool created = fileBytes == 0 && !readOnly;
+        if(created)
+        {
+            fileBytes = HEADER_SIZE;
+            if(ftruncate(fd, static_cast<off_t>(fileBytes)) != 0)
+            {
+                close(fd);
+                fail("ftruncate");
+            }
+        }
+        if(fileBytes < HEADER_SIZE)
+        {
+            close(fd);
+            throw std::runtime_error("Not a MappedVector file: " + path);
+        }
+
+        void* mapped = mmap(nullptr, fileBytes, readOnly ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if(mapped == MAP_FAILED)
+        {
+            close(fd);
+            fail("mmap");
+        }
+        mapping = static_cast<char*>(mapped);
+        mappedBytes = fileBytes;
+
+        if(created)
+        {
+            header()->magic = MAGIC;
+            header()->elementSize = sizeof(Type);
+            header()->size = 0;
+        }
+        capacity = (fileBytes - HEADER_SIZE) / sizeof(Type);
+        size = header()->size;
+        if(header()->magic != MAGIC || header()->elementSize != sizeof(Type) || size > capacity)
+        {
+            readOnly = true;
+            release();
+            throw std::runtime_error("Not a MappedVector file of this element type: " + path);
+        }
+    }
+
+    MappedVector(const MappedVector&) = delete;
+    MappedVector& operator=(const MappedVector&) = delete;
+
+    MappedVector(MappedVector&& other) : fd(other.fd), readOnly(other.readOnly), mapping(other.mapping),
+                    mappedBytes(other.mappedBytes), size(other.size), capacity(other.capacity)
+    {
+        other.fd = -1;
+        other.mapping = nullptr;
+    }
+
+    ~MappedVector()
+    {
+        release();
+    }
+
+    bool isReadOnly() const
+    {
+        return readOnly;
+    }
+
+    bool isEmpty() const
+    {
+        return size == 0;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    size_type getCapacity() const
+    {
+        return capacity;
+    }
+
+    //Direct access to the mapped elements (valid until the file grows)
+    pointer data()
+    {
+        checkWritable();
+        return elements();
+    }
+
+    const_pointer data() const
+    {
+        return elements();
+    }
+
+    //Store the element count in the header and flush dirty pages to the file
+    void sync()
+    {
+        checkWritable();
+        header()->size = size;
+        if(msync(mapping, mappedBytes, MS_SYNC) != 0) fail("msync");
+    }
+
+    //Tell the kernel how the elements are going to be read (read-ahead or not)
+    void advise(AccessPattern pattern) const
+    {
+        int advice = pattern == AccessPattern::Sequential ? MADV_SEQUENTIAL
+                   : pattern == AccessPattern::Random ? MADV_RANDOM : MADV_NORMAL;
+        if(madvise(mapping, mappedBytes, advice) != 0) fail("madvise");
+    }
+
+    void reserve(size_type newCapacity)
+    {
+        checkWritable();
+        if(newCapacity > capacity) remap(newCapacity);
+    }
+
+    //Change the number of stored elements, new ones are value-initialized
+    void resize(size_type newSize)
+    {
+        reserve(newSize);
+        for(size_type i = size; i < newSize; ++i)
+            elements()[i] = value_type();
+        size = newSize;
+        header()->size = size;
+    }
+
+    void append(const Type& item)
+    {
+        insert(end(), item);
+    }
+
+    //Copy *count* elements to the end in one block
+    void append(const_pointer items, size_type count)
+    {
+        checkWritable();
+        if(size + count > capacity)
+            remap(std::max<size_type>(size + count, capacity > 1 ? capacity * (1 + INCREASE_FACTOR) : capacity + 1));
+        std::memcpy(elements() + size, items, count * sizeof(Type));
+        size += count;
+        header()->size = size;
+    }
+
+    void prepend(const Type& item)
+    {
+        insert(begin(), item);
+    }
+
+    void insert(const const_iterator& insertPosition, const Type& item)
+    {
+        checkWritable();
+        const size_type index = insertPosition.element - elements();
+        const value_type copy = item; //*item* may live in the mapping that is about to move or shift
+        if(size == capacity)
+            remap(capacity > 1 ? capacity * (1 + INCREASE_FACTOR) : capacity + 1);
+        std::memmove(elements() + index + 1, elements() + index, (size - index) * sizeof(Type));
+        elements()[index] = copy;
+        ++size;
+        header()->size = size;
+    }
+
+    value_type popFirst()
+    {
+        if(isEmpty()) throw std::logic_error("Vector is empty");
+        checkWritable();
+        value_type temp = *cbegin();
+        erase(begin());
+        return temp;
+    }
+
+    value_type popLast()
+    {
+        if(isEmpty()) throw std::logic_error("Vector is empty");
+        checkWritable();
+        value_type temp = elements()[--size];
+        header()->size = size;
+        return temp;
+    }
+
+    void erase(const const_iterator& possition)
+    {
+        erase(possition, possition + 1);
+    }
+
+    void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded)
+    {
+        if(isEmpty()) throw std::out_of_range("Vector is empty");
+        checkWritable();
+        const size_type first = firstIncluded.element - elements();
+        const size_type last = lastExcluded.element - elements();
+        if(last < first || last > size) throw std::out_of_range("firstIncluded should be before lastExcluded");
+        std::memmove(elements() + first, elements() + last, (size - last) * sizeof(Type));
+        size -= last - first;
+        header()->size = size;
+    }
+
+    iterator begin()
+    {
+        return iterator(const_iterator(this, elements()));
+    }
+
+    iterator end()
+    {
+        return iterator(const_iterator(this, elements() + size));
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(this, elements());
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(this, elements() + size);
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+};
+
+template <typename Type>
+class MappedVector<Type>::ConstIterator
+{
+public:
+    friend class MappedVector<Type>;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename MappedVector::value_type;
+    using difference_type = typename MappedVector::difference_type;
+    using pointer = typename MappedVector::const_pointer;
+    using reference = typename MappedVector::const_reference;
+
+protected:
+    pointer element;
+    const MappedVector<Type>* parent_vec;
+
+public:
+    explicit ConstIterator()
+    {}
+
+    ConstIterator(const MappedVector<Type>* parent, pointer ptr) : element(ptr), parent_vec(parent)
+    {}
+
+    reference operator*() const
+    {
+        if(*this == parent_vec->end()) throw std::out_of_range("Iterator points at empty space after the last element");
+        return *element;
+    }
+
+    ConstIterator& operator++()
+    {
+        if(*this == parent_vec->end()) throw std::out_of_range("Cannot increment iterator");
+        ++element;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    ConstIterator& operator--()
+    {
+        if(*this == parent_vec->begin()) throw std::out_of_range("Cannot decrement iterator");
+        --element;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        return ConstIterator(parent_vec, element + d);
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        return ConstIterator(parent_vec, element - d);
+    }
+
+    bool operator==(const ConstIterator& other) const
+    {
+        return element == other.element;
+    }
+
+    bool operator!=(const ConstIterator& other) const
+    {
+        return element != other.element;
+    }
+};
+
+template <typename Type>
+class MappedVector<Type>::Iterator : public MappedVector<Type>::ConstIterator
+{
+public:
+    using pointer = typename MappedVector::pointer;
+    using reference = typename MappedVector::reference;
+
+    explicit Iterator()
+    {}
+
+    Iterator(const ConstIterator& other) : ConstIterator(other)
+    {}
+
+    Iterator& operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator& operator--()
+    {
+        ConstIterator::operator--();
+        return *this;
+    }
+
+    Iterator operator--(int)
+    {
+        auto result = *this;
+        ConstIterator::operator--();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    Iterator operator-(difference_type d) const
+    {
+        return ConstIterator::operator-(d);
+    }
+
+    //Writable access, which a read-only mapping refuses (its pages are mapped PROT_READ)
+    reference operator*() const
+    {
+        this->parent_vec->checkWritable();
+        // ugly cast, yet reduces code duplication.
+        return const_cast<reference>(ConstIterator::operator*());
+    }
+};
+
+//Read-only view of a MappedVector file. It has only const access, so range-for and the std
+//algorithms read the elements through const iterators and no write can be attempted.
+template <typename Type>
+class MappedVectorView
+{
+public:
+    using vector_type = MappedVector<Type>;
+    using difference_type = typename vector_type::difference_type;
+    using size_type = typename vector_type::size_type;
+    using value_type = typename vector_type::value_type;
+    using const_pointer = typename vector_type::const_pointer;
+    using const_reference = typename vector_type::const_reference;
+    using const_iterator = typename vector_type::const_iterator;
+    using iterator = const_iterator;
+    using AccessPattern = typename vector_type::AccessPattern;
+
+private:
+    const vector_type vector;
+
+public:
+    explicit MappedVectorView(const std::string& path) : vector(path, vector_type::OpenMode::ReadOnly)
+    {}
+
+    bool isEmpty() const
+    {
+        return vector.isEmpty();
+    }
+
+    size_type getSize() const
+    {
+        return vector.getSize();
+    }
+
+    const_pointer data() const
+    {
+        return vector.data();
+    }
+
+    void advise(AccessPattern pattern) const
+    {
+        vector.advise(pattern);
+    }
+
+    const_iterator begin() const
+    {
+        return vector.begin();
+    }
+
+    const_iterator end() const
+    {
+        return vector.end();
+    }
+
+    const_iterator cbegin() const
+    {
+        return vector.cbegin();
+    }
+
+    const_iterator cend() const
+    {
+        return vector.cend();
+    }
+};
+
+}
+
+#endif // AISDI_LINEAR_MAPPEDVECTOR_H
@@ -0,0 +1,562 @@
+#ifndef AISDI_LINEAR_OFFSETLIST_H
+#define AISDI_LINEAR_OFFSETLIST_H
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace aisdi
+{
+
+//Doubly linked list of trivially copyable elements whose nodes live in one region and link
+//to each other by offsets from the region start instead of pointers. The region is either
+//an anonymous arena or a memory-mapped file; it may move when it grows, and a file written
+//by one process is a complete list for another one, reopened with a single mmap call.
+template <typename Type>
+class OffsetList
+{
+    static_assert(std::is_trivially_copyable<Type>::value, "OffsetList needs trivially copyable elements");
+
+public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type*;
+    using reference = Type&;
+    using const_pointer = const Type*;
+    using const_reference = const Type&;
+    using offset_type = std::uint64_t;
+
+    class ConstIterator;
+    class Iterator;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+private:
+    struct Node
+    {
+        value_type data;
+        offset_type next; //0 after the last node
+        offset_type prev; //0 before the first node
+    };
+
+    struct Header
+    {
+        std::uint64_t magic;
+        std::uint64_t elementSize;
+        std::uint64_t nodeSize;
+        offset_type first;
+        offset_type last;
+        offset_type freeNodes; //Erased nodes, linked through next
+        std::uint64_t size;
+        std::uint64_t used; //Bytes of the region taken by the header and the nodes ever allocated
+    };
+
+    static const std::uint64_t MAGIC = 0x31534C4F49534941ULL; //"AISIOLS1"
+    static const size_type HEADER_SIZE = 64; //Offset of the first node, never a valid link
+    static const size_type INITIAL_BYTES = 4096;
+
+    static_assert(sizeof(Header) <= HEADER_SIZE, "Header has to fit in HEADER_SIZE");
+
+    int fd; //-1 for an anonymous arena
+    char* region;
+    size_type regionBytes;
+    const double INCREASE_FACTOR = 0.5; //Factor by which the region will be increased when it is full
+
+    static void fail(const char* what)
+    {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    Header* header() const
+    {
+        return reinterpret_cast<Header*>(region);
+    }
+
+    Node* nodeAt(offset_type offset) const
+    {
+        return reinterpret_cast<Node*>(region + offset);
+    }
+
+    void initialize()
+    {
+        Header* h = header();
+        std::memset(h, 0, HEADER_SIZE);
+        h->magic = MAGIC;
+        h->elementSize = sizeof(Type);
+        h->nodeSize = sizeof(Node);
+        h->used = HEADER_SIZE;
+    }
+
+    //Resize the region to *bytes*; the base address may change, the offsets stay valid
+    void remap(size_type bytes)
+    {
+        if(fd >= 0 && ftruncate(fd, static_cast<off_t>(bytes)) != 0) fail("ftruncate");
+#ifdef MREMAP_MAYMOVE
+        void* moved = mremap(region, regionBytes, bytes, MREMAP_MAYMOVE);
+        if(moved == MAP_FAILED) fail("mremap");
+#else
+        void* moved = fd >= 0 ? mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)
+                              : mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(moved == MAP_FAILED) fail("mmap");
+        if(fd < 0) std::memcpy(moved, region, regionBytes);
+        munmap(region, regionBytes);
+#endif
+        region = static_cast<char*>(moved);
+        regionBytes = bytes;
+    }
+
+    offset_type allocate(const Type& item)
+    {
+        const value_type copy = item; //*item* may live in the region that is about to move
+        Header* h = header();
+        offset_type offset = h->freeNodes;
+        if(offset) h->freeNodes = nodeAt(offset)->next;
+        else
+        {
+            if(h->used + sizeof(Node) > regionBytes)
+                remap(regionBytes + static_cast<size_type>(regionBytes * INCREASE_FACTOR) + sizeof(Node));
+            h = header();
+            offset = h->used;
+            h->used += sizeof(Node);
+        }
+        Node* nd = nodeAt(offset);
+        nd->data = copy;
+        nd->next = nd->prev = 0;
+        return offset;
+    }
+
+    void deallocate(offset_type offset)
+    {
+        nodeAt(offset)->next = header()->freeNodes;
+        header()->freeNodes = offset;
+    }
+
+    //Detach the node at *offset* from its neighbours and free it
+    void unlink(offset_type offset)
+    {
+        Header* h = header();
+        Node* nd = nodeAt(offset);
+        if(nd->prev) nodeAt(nd->prev)->next = nd->next;
+        else h->first = nd->next;
+        if(nd->next) nodeAt(nd->next)->prev = nd->prev;
+        else h->last = nd->prev;
+        --h->size;
+        deallocate(offset);
+    }
+
+    //Whether *offset* is 0 or the start of a node allocated in the region
+    bool isLink(offset_type offset) const
+    {
+        const Header* h = header();
+        return offset == 0 || (offset >= HEADER_SIZE && offset < h->used && (offset - HEADER_SIZE) % sizeof(Node) == 0);
+    }
+
+    //Check the header of a reopened region in O(1): the node grid and the head offsets. The
+    //links between nodes are only walked by validate()
+    bool isHeaderConsistent() const
+    {
+        const Header* h = header();
+        if(h->used < HEADER_SIZE || (h->used - HEADER_SIZE) % sizeof(Node) != 0) return false;
+        if(!isLink(h->first) || !isLink(h->last) || !isLink(h->freeNodes)) return false;
+        const std::uint64_t nodes = (h->used - HEADER_SIZE) / sizeof(Node);
+        return h->size <= nodes && (h->first == 0) == (h->size == 0) && (h->last == 0) == (h->size == 0);
+    }
+
+    //Unmap and close a region that cannot be opened
+    void reject(const std::string& what)
+    {
+        munmap(region, regionBytes);
+        region = nullptr;
+        close(fd);
+        fd = -1;
+        throw std::runtime_error(what);
+    }
+
+    void release()
+    {
+        if(region)
+        {
+            if(fd >= 0)
+            {
+                const size_type used = header()->used;
+                munmap(region, regionBytes);
+                //Drop the spare space; if that fails the file just keeps it
+                int truncated = ftruncate(fd, static_cast<off_t>(used));
+                static_cast<void>(truncated);
+            }
+            else munmap(region, regionBytes);
+        }
+        region = nullptr;
+        if(fd >= 0) close(fd);
+        fd = -1;
+    }
+
+public:
+    //Empty list in an anonymous arena
+    OffsetList() : fd(-1), region(nullptr), regionBytes(INITIAL_BYTES)
+    {
+        void* mapped = mmap(nullptr, regionBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(mapped == MAP_FAILED) fail("mmap");
+        region = static_cast<char*>(mapped);
+        initialize();
+    }
+
+    OffsetList(std::initializer_list<Type> l) : OffsetList()
+    {
+        for(const value_type& i : l)
+            append(i);
+    }
+
+    //List stored in the file at *path*, created empty if the file does not exist
+    explicit OffsetList(const std::string& path) : fd(-1), region(nullptr), regionBytes(0)
+    {
+        fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if(fd < 0) fail("open");
+
+        struct stat info;
+        if(fstat(fd, &info) != 0)
+        {
+            close(fd);
+            fail("fstat");
+        }
+        size_type fileBytes = static_cast<size_type>(info.st_size);
+        const bool created = fileBytes == 0;
+        if(created)
+        {
+            fileBytes = INITIAL_BYTES;
+            if(ftruncate(fd, static_cast<off_t>(fileBytes)) != 0)
+            {
+                close(fd);
+                fail("ftruncate");
+            }
+        }
+        if(fileBytes < HEADER_SIZE)
+        {
+            close(fd);
+            throw std::runtime_error("Not an OffsetList file: " + path);
+        }
+
+        void* mapped = mmap(nullptr, fileBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if(mapped == MAP_FAILED)
+        {
+            close(fd);
+            fail("mmap");
+        }
+        region = static_cast<char*>(mapped);
+        regionBytes = fileBytes;
+
+        if(created) initialize();
+        const Header* h = header();
+        if(h->magic != MAGIC || h->elementSize != sizeof(Type) || h->nodeSize != sizeof(Node) || h->used > regionBytes)
+            reject("Not an OffsetList file of this element type: " + path);
+        if(!isHeaderConsistent()) reject("Corrupted OffsetList file: " + path);
+    }
+
+    OffsetList(const OffsetList&) = delete;
+    OffsetList& operator=(const OffsetList&) = delete;
+
+    OffsetList(OffsetList&& other) : fd(other.fd), region(other.region), regionBytes(other.regionBytes)
+    {
+        other.fd = -1;
+        other.region = nullptr;
+    }
+
+    ~OffsetList()
+    {
+        release();
+    }
+
+    bool isEmpty() const
+    {
+        return header()->size == 0;
+    }
+
+    size_type getSize() const
+    {
+        return header()->size;
+    }
+
+    //Bytes taken by the header and all nodes, i.e. the size of the persisted file
+    size_type getRegionSize() const
+    {
+        return header()->used;
+    }
+
+    //Walk every live and free node and check its links; reopening checks only the header, so
+    //call this once before trusting a file that may have been corrupted. O(n)
+    bool validate() const
+    {
+        const Header* h = header();
+        if(!isHeaderConsistent()) return false;
+        const std::uint64_t nodes = (h->used - HEADER_SIZE) / sizeof(Node);
+
+        offset_type previous = 0;
+        std::uint64_t count = 0;
+        for(offset_type offset = h->first; offset; offset = nodeAt(offset)->next)
+        {
+            const Node* nd = nodeAt(offset);
+            if(++count > h->size || nd->prev != previous || !isLink(nd->next)) return false;
+            previous = offset;
+        }
+        if(count != h->size || previous != h->last) return false;
+
+        for(offset_type offset = h->freeNodes; offset; offset = nodeAt(offset)->next)
+            if(++count > nodes || !isLink(nodeAt(offset)->next)) return false;
+        return true;
+    }
+
+    //Flush the region to its file (no-op for an anonymous arena)
+    void sync()
+    {
+        if(fd >= 0 && msync(region, regionBytes, MS_SYNC) != 0) fail("msync");
+    }
+
+    void append(const Type& item)
+    {
+        insert(end(), item);
+    }
+
+    void prepend(const Type& item)
+    {
+        insert(begin(), item);
+    }
+
+    void insert(const const_iterator& insertPosition, const Type& item)
+    {
+        const offset_type before = insertPosition.offset;
+        const offset_type offset = allocate(item);
+        Header* h = header();
+        Node* nd = nodeAt(offset);
+        nd->next = before;
+        nd->prev = before ? nodeAt(before)->prev : h->last;
+        if(nd->prev) nodeAt(nd->prev)->next = offset;
+        else h->first = offset;
+        if(before) nodeAt(before)->prev = offset;
+        else h->last = offset;
+        ++h->size;
+    }
+
+    value_type popFirst()
+    {
+        if(isEmpty()) throw std::logic_error("List is empty");
+        const offset_type offset = header()->first;
+        value_type data = nodeAt(offset)->data;
+        unlink(offset);
+        return data;
+    }
+
+    value_type popLast()
+    {
+        if(isEmpty()) throw std::logic_error("List is empty");
+        const offset_type offset = header()->last;
+        value_type data = nodeAt(offset)->data;
+        unlink(offset);
+        return data;
+    }
+
+    void erase(const const_iterator& possition)
+    {
+        if(possition.offset == 0) throw std::out_of_range("Cannot erase end iterator");
+        unlink(possition.offset);
+    }
+
+    void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded)
+    {
+        offset_type offset = firstIncluded.offset;
+        while(offset != lastExcluded.offset)
+        {
+            if(offset == 0) throw std::out_of_range("firstIncluded should be before lastExcluded");
+            const offset_type next = nodeAt(offset)->next;
+            unlink(offset);
+            offset = next;
+        }
+    }
+
+    iterator begin()
+    {
+        return iterator(const_iterator(this, header()->first));
+    }
+
+    iterator end()
+    {
+        return iterator(const_iterator(this, 0));
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(this, header()->first);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+};
+
+//Iterators hold offsets, so they stay valid when the region moves
+template <typename Type>
+class OffsetList<Type>::ConstIterator
+{
+public:
+    friend class OffsetList<Type>;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename OffsetList::value_type;
+    using difference_type = typename OffsetList::difference_type;
+    using pointer = typename OffsetList::const_pointer;
+    using reference = typename OffsetList::const_reference;
+
+private:
+    const OffsetList<Type>* parent_list;
+    offset_type offset; //0 for end()
+
+public:
+    explicit ConstIterator() : parent_list(nullptr), offset(0)
+    {}
+
+    ConstIterator(const OffsetList<Type>* parent, offset_type o) : parent_list(parent), offset(o)
+    {}
+
+    reference operator*() const
+    {
+        if(offset == 0) throw std::out_of_range("Iterator points at empty space after the last element");
+        return parent_list->nodeAt(offset)->data;
+    }
+
+    ConstIterator& operator++()
+    {
+        if(offset == 0) throw std::out_of_range("Cannot increment iterator");
+        offset = parent_list->nodeAt(offset)->next;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    ConstIterator& operator--()
+    {
+        const offset_type previous = offset ? parent_list->nodeAt(offset)->prev : parent_list->header()->last;
+        if(previous == 0) throw std::out_of_range("Cannot decrement iterator");
+        offset = previous;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        ConstIterator temp(*this);
+        for(difference_type i = 0; i < d; ++i)
+            ++temp;
+        return temp;
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        ConstIterator temp(*this);
+        for(difference_type i = 0; i < d; ++i)
+            --temp;
+        return temp;
+    }
+
+    bool operator==(const ConstIterator& other) const
+    {
+        return offset == other.offset;
+    }
+
+    bool operator!=(const ConstIterator& other) const
+    {
+        return offset != other.offset;
+    }
+};
+
+template <typename Type>
+class OffsetList<Type>::Iterator : public OffsetList<Type>::ConstIterator
+{
+public:
+    using pointer = typename OffsetList::pointer;
+    using reference = typename OffsetList::reference;
+
+    explicit Iterator()
+    {}
+
+    Iterator(const ConstIterator& other) : ConstIterator(other)
+    {}
+
+    Iterator& operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator& operator--()
+    {
+        ConstIterator::operator--();
+        return *this;
+    }
+
+    Iterator operator--(int)
+    {
+        auto result = *this;
+        ConstIterator::operator--();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    Iterator operator-(difference_type d) const
+    {
+        return ConstIterator::operator-(d);
+    }
+
+    reference operator*() const
+    {
+        // ugly cast, yet reduces code duplication.
+        return const_cast<reference>(ConstIterator::operator*());
+    }
+};
+
+}
+
+#endif // AISDI_LINEAR_OFFSETLIST_H
@@ -0,0 +1,335 @@
+#ifndef AISDI_LINEAR_PARALLELALGORITHMS_H
+#define AISDI_LINEAR_PARALLELALGORITHMS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "LinkedList.h"
+#include "ThreadPool.h"
+#include "Vector.h"
+
+namespace aisdi
+{
+namespace parallel
+{
+
+const std::size_t CACHE_LINE_SIZE = 64;
+const std::size_t CHUNK_BYTES = 64 * 1024; //Amount of data handed to a single task
+const std::size_t SORT_GRAIN = 8 * 1024; //Ranges up to this many elements are sorted sequentially
+const std::size_t MERGE_GRAIN = 16 * 1024; //Merges up to this many elements are not split any further
+const std::size_t LIST_PARTS = 256; //Number of ranges a LinkedList is split into, independent of the thread count
+
+namespace detail
+{
+
+//Number of elements of *Type* that fill a cache line (1 if they do not tile it exactly)
+template <typename Type>
+std::size_t elementsPerLine()
+{
+    return sizeof(Type) < CACHE_LINE_SIZE && CACHE_LINE_SIZE % sizeof(Type) == 0
+            ? CACHE_LINE_SIZE / sizeof(Type) : 1;
+}
+
+//Split [0, size) into chunks of about CHUNK_BYTES. Chunk length is a multiple of a cache line.
+//When *alignToAddress* is set, inner boundaries also fall on cache-line addresses of *data*,
+//so tasks writing neighbouring chunks never share a line. Otherwise the split depends only on
+//*size*, which keeps reductions reproducible between runs and thread counts.
+template <typename Type>
+std::vector<std::size_t> chunkBounds(const Type* data, std::size_t size, bool alignToAddress)
+{
+    const std::size_t line = elementsPerLine<Type>();
+    std::size_t chunk = std::max<std::size_t>(1, CHUNK_BYTES / sizeof(Type));
+    chunk = (chunk + line - 1) / line * line;
+
+    std::size_t head = 0;
+    const std::uintptr_t offset = reinterpret_cast<std::uintptr_t>(data) % CACHE_LINE_SIZE;
+    if(alignToAddress && line > 1 && offset % sizeof(Type) == 0)
+        head = (CACHE_LINE_SIZE - offset) % CACHE_LINE_SIZE / sizeof(Type);
+
+    std::vector<std::size_t> bounds(1, 0);
+    for(std::size_t b = head + chunk; b < size; b += chunk)
+        bounds.push_back(b);
+    bounds.push_back(size);
+    return bounds;
+}
+
+//Call body(rangeIndex, first, last) for every pair of neighbouring bounds (indices or iterators),
+//spreading the calls over *pool*
+template <typename Bound, typename Body>
+void runRanges(const std::vector<Bound>& points, Body body, ThreadPool& pool)
+{
+    const std::size_t ranges = points.size() - 1;
+    if(ranges == 1 || pool.getThreadCount() == 1)
+    {
+        for(std::size_t i = 0; i < ranges; ++i)
+            body(i, points[i], points[i + 1]);
+        return;
+    }
+    TaskGroup group(pool);
+    for(std::size_t i = 1; i < ranges; ++i)
+        group.run([&body, &points, i]{ body(i, points[i], points[i + 1]); });
+    body(0, points[0], points[1]);
+    group.wait();
+}
+
+//Stable merge of [first1, last1) and [first2, last2) into *out*, split recursively by binary search
+template <typename Type, typename Compare>
+void merge(Type* first1, Type* last1, Type* first2, Type* last2, Type* out, Compare comp, ThreadPool& pool)
+{
+    const std::size_t n1 = last1 - first1, n2 = last2 - first2;
+    if(n1 + n2 <= MERGE_GRAIN || pool.getThreadCount() == 1)
+    {
+        std::merge(std::make_move_iterator(first1), std::make_move_iterator(last1),
+                   std::make_move_iterator(first2), std::make_move_iterator(last2), out, comp);
+        return;
+    }
+
+    Type *mid1, *mid2;
+    if(n1 >= n2)
+    {
+        mid1 = first1 + n1 / 2;
+        mid2 = std::lower_bound(first2, last2, *mid1, comp);
+    }
+    else
+    {
+        mid2 = first2 + n2 / 2;
+        mid1 = std::upper_bound(first1, last1, *mid2, comp);
+    }
+    Type* outMid = out + (mid1 - first1) + (mid2 - first2);
+
+    TaskGroup group(pool);
+    group.run([=, &pool]{ merge(first1, mid1, first2, mid2, out, comp, pool); });
+    merge(mid1, last1, mid2, last2, outMid, comp, pool);
+    group.wait();
+}
+
+//Sort *size* elements of *data*, leaving the result in *scratch* if *intoScratch* is set.
+//Both halves are sorted into the other buffer, so each level costs one merge pass only.
+template <typename Type, typename Compare>
+void mergeSort(Type* data, Type* scratch, std::size_t size, bool intoScratch, Compare comp, ThreadPool& pool)
+{
+    if(size <= SORT_GRAIN)
+    {
+        std::stable_sort(data, data + size, comp);
+        if(intoScratch) std::move(data, data + size, scratch);
+        return;
+    }
+
+    const std::size_t half = size / 2;
+    {
+        TaskGroup group(pool);
+        group.run([=, &pool]{ mergeSort(data, scratch, half, !intoScratch, comp, pool); });
+        mergeSort(data + half, scratch + half, size - half, !intoScratch, comp, pool);
+        group.wait();
+    }
+
+    Type* from = intoScratch ? data : scratch;
+    Type* to = intoScratch ? scratch : data;
+    merge(from, from + half, from + half, from + size, to, comp, pool);
+}
+
+}
+
+//Call f(element) for every element of *vector*
+template <typename Type, typename Function>
+void forEach(Vector<Type>& vector, Function f, ThreadPool& pool = ThreadPool::defaultPool())
+{
+    Type* data = vector.data();
+    detail::runRanges(detail::chunkBounds(data, vector.getSize(), true),
+                      [data, &f](std::size_t, std::size_t first, std::size_t last)
+                      {
+                          for(std::size_t i = first; i < last; ++i)
+                              f(data[i]);
+                      }, pool);
+}
+
+template <typename Type, typename Function>
+void forEach(const Vector<Type>& vector, Function f, ThreadPool& pool = ThreadPool::defaultPool())
+{
+    const Type* data = vector.data();
+    detail::runRanges(detail::chunkBounds(data, vector.getSize(), true),
+                      [data, &f](std::size_t, std::size_t first, std::size_t last)
+                      {
+                          for(std::size_t i = first; i < last; ++i)
+                              f(data[i]);
+                      }, pool);
+}
+
+//Store f(source[i]) in destination[i]; *destination* is resized to the size of *source*
+template <typename Type, typename Result, typename Function>
+void transform(const Vector<Type>& source, Vector<Result>& destination, Function f,
+               ThreadPool& pool = ThreadPool::defaultPool())
+{
+    destination.resize(source.getSize());
+    const Type* from = source.data();
+    Result* to = destination.data();
+    detail::runRanges(detail::chunkBounds(to, source.getSize(), true),
+                      [from, to, &f](std::size_t, std::size_t first, std::size_t last)
+                      {
+                          for(std::size_t i = first; i < last; ++i)
+                              to[i] = f(from[i]);
+                      }, pool);
+}
+
+//Fold *vector* with *op* starting from *init*. Every chunk is folded separately and partial
+//results are combined in chunk order; chunks depend only on the size, so the result
+//(including floating point rounding) is the same for any number of threads.
+template <typename Type, typename BinaryOperation>
+Type reduce(const Vector<Type>& vector, Type init, BinaryOperation op,
+            ThreadPool& pool = ThreadPool::defaultPool())
+{
+    const Type* data = vector.data();
+    const std::vector<std::size_t> bounds = detail::chunkBounds(data, vector.getSize(), false);
+    std::unique_ptr<Type[]> partial(new Type[bounds.size() - 1]);
+    detail::runRanges(bounds, [data, &op, &partial](std::size_t chunk, std::size_t first, std::size_t last)
+                      {
+                          if(first == last) return;
+                          Type acc = data[first];
+                          for(std::size_t i = first + 1; i < last; ++i)
+                              acc = op(acc, data[i]);
+                          partial[chunk] = acc;
+                      }, pool);
+
+    for(std::size_t i = 0; i + 1 < bounds.size(); ++i)
+        if(bounds[i] != bounds[i + 1]) init = op(init, partial[i]);
+    return init;
+}
+
+template <typename Type>
+Type reduce(const Vector<Type>& vector, Type init = Type(), ThreadPool& pool = ThreadPool::defaultPool())
+{
+    return reduce(vector, init, std::plus<Type>(), pool);
+}
+
+//Number of elements satisfying *predicate*
+template <typename Type, typename Predicate>
+std::size_t countIf(const Vector<Type>& vector, Predicate predicate, ThreadPool& pool = ThreadPool::defaultPool())
+{
+    const Type* data = vector.data();
+    const std::vector<std::size_t> bounds = detail::chunkBounds(data, vector.getSize(), false);
+    std::vector<std::size_t> partial(bounds.size() - 1, 0);
+    detail::runRanges(bounds, [data, &predicate, &partial](std::size_t chunk, std::size_t first, std::size_t last)
+                      {
+                          std::size_t found = 0;
+                          for(std::size_t i = first; i < last; ++i)
+                              if(predicate(data[i])) ++found;
+                          partial[chunk] = found;
+                      }, pool);
+
+    std::size_t total = 0;
+    for(std::size_t found : partial)
+        total += found;
+    return total;
+}
+
+template <typename Type>
+std::size_t count(const Vector<Type>& vector, const Type& value, ThreadPool& pool = ThreadPool::defaultPool())
+{
+    return countIf(vector, [&value](const Type& item){ return item == value; }, pool);
+}
+
+//LinkedList versions walk sublists between split points computed in one pass over the list
+
+template <typename Type, typename Function>
+void forEach(LinkedList<Type>& list, Function f, ThreadPool& pool = ThreadPool::defaultPool())
+{
+    using Iterator = typename LinkedList<Type>::iterator;
+    detail::runRanges(list.splitPoints(LIST_PARTS),
+                      [&f](std::size_t, Iterator first, Iterator last)
+                      {
+                          for(; first != last; ++first)
+                              f(*first);
+                      }, pool);
+}
+
+template <typename Type, typename Function>
+void forEach(const LinkedList<Type>& list, Function f, ThreadPool& pool = ThreadPool::defaultPool())
+{
+    using ConstIterator = typename LinkedList<Type>::const_iterator;
+    detail::runRanges(list.splitPoints(LIST_PARTS),
+                      [&f](std::size_t, ConstIterator first, ConstIterator last)
+                      {
+                          for(; first != last; ++first)
+                              f(*first);
+                      }, pool);
+}
+
+//Split points depend only on the list length, so the result is the same for any number of threads
+template <typename Type, typename BinaryOperation>
+Type reduce(const LinkedList<Type>& list, Type init, BinaryOperation op,
+            ThreadPool& pool = ThreadPool::defaultPool())
+{
+    using ConstIterator = typename LinkedList<Type>::const_iterator;
+    const std::vector<ConstIterator> points = list.splitPoints(LIST_PARTS);
+    std::unique_ptr<Type[]> partial(new Type[points.size() - 1]);
+    detail::runRanges(points, [&op, &partial](std::size_t range, ConstIterator first, ConstIterator last)
+                      {
+                          if(first == last) return;
+                          Type acc = *first;
+                          for(++first; first != last; ++first)
+                              acc = op(acc, *first);
+                          partial[range] = acc;
+                      }, pool);
+
+    for(std::size_t i = 0; i + 1 < points.size(); ++i)
+        if(points[i] != points[i + 1]) init = op(init, partial[i]);
+    return init;
+}
+
+template <typename Type>
+Type reduce(const LinkedList<Type>& list, Type init = Type(), ThreadPool& pool = ThreadPool::defaultPool())
+{
+    return reduce(list, init, std::plus<Type>(), pool);
+}
+
+template <typename Type, typename Predicate>
+std::size_t countIf(const LinkedList<Type>& list, Predicate predicate, ThreadPool& pool = ThreadPool::defaultPool())
+{
+    using ConstIterator = typename LinkedList<Type>::const_iterator;
+    const std::vector<ConstIterator> points = list.splitPoints(LIST_PARTS);
+    std::vector<std::size_t> partial(points.size() - 1, 0);
+    detail::runRanges(points, [&predicate, &partial](std::size_t range, ConstIterator first, ConstIterator last)
+                      {
+                          std::size_t found = 0;
+                          for(; first != last; ++first)
+                              if(predicate(*first)) ++found;
+                          partial[range] = found;
+                      }, pool);
+
+    std::size_t total = 0;
+    for(std::size_t found : partial)
+        total += found;
+    return total;
+}
+
+template <typename Type>
+std::size_t count(const LinkedList<Type>& list, const Type& value, ThreadPool& pool = ThreadPool::defaultPool())
+{
+    return countIf(list, [&value](const Type& item){ return item == value; }, pool);
+}
+
+//Stable parallel merge sort
+template <typename Type, typename Compare>
+void sort(Vector<Type>& vector, Compare comp, ThreadPool& pool = ThreadPool::defaultPool())
+{
+    const std::size_t size = vector.getSize();
+    if(size < 2) return;
+    std::unique_ptr<Type[]> scratch(new Type[size]);
+    detail::mergeSort(vector.data(), scratch.get(), size, false, comp, pool);
+}
+
+template <typename Type>
+void sort(Vector<Type>& vector, ThreadPool& pool = ThreadPool::defaultPool())
+{
+    sort(vector, std::less<Type>(), pool);
+}
+
+}
+}
+
+#endif // AISDI_LINEAR_PARALLELALGORITHMS_H
@@ -0,0 +1,70 @@
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "BenchmarkUtils.h"
+#include "ParallelAlgorithms.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+
+template <typename T>
+aisdi::Vector<T> makeData(std::size_t size)
+{
+    aisdi::Vector<T> data;
+    data.resize(size);
+    unsigned seed = 2016;
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        data.data()[i] = static_cast<T>((seed >> 8) % 100);
+    }
+    return data;
+}
+
+template <typename T>
+void perfomTest(const std::string& typeName, std::size_t size, std::size_t maxThreads)
+{
+    std::cout << "Vector<" << typeName << ">, " << size << " elements" << std::endl;
+    std::cout << "threads  forEach[ms]  transform[ms]  reduce[ms]  count[ms]  sort[ms]" << std::endl;
+
+    const aisdi::Vector<T> source = makeData<T>(size);
+    for(std::size_t threads = 1; threads <= maxThreads; ++threads)
+    {
+        aisdi::ThreadPool pool(threads);
+        aisdi::Vector<T> data = source;
+        aisdi::Vector<T> output;
+        T sum = T();
+        std::size_t found = 0;
+
+        double forEachMs = measureMs([&]{ aisdi::parallel::forEach(data, [](T& x){ x = x * 3 + 1; }, pool); });
+        double transformMs = measureMs([&]{ aisdi::parallel::transform(data, output, [](T x){ return x / 2; }, pool); });
+        double reduceMs = measureMs([&]{ sum = aisdi::parallel::reduce(source, T(), pool); });
+        double countMs = measureMs([&]{ found = aisdi::parallel::count(source, T(42), pool); });
+        double sortMs = measureMs([&]{ aisdi::parallel::sort(data, pool); });
+
+        std::cout << std::setw(7) << threads << std::fixed << std::setprecision(1)
+                  << std::setw(13) << forEachMs << std::setw(15) << transformMs
+                  << std::setw(12) << reduceMs << std::setw(11) << countMs
+                  << std::setw(10) << sortMs
+                  << "   (sum " << sum << ", found " << found << ")" << std::endl;
+    }
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const std::size_t size = argc > 1 ? std::atoll(argv[1]) : 10000000;
+    const std::size_t maxThreads = argc > 2 ? std::atoll(argv[2]) : aisdi::ThreadPool::defaultThreadCount();
+
+    perfomTest<double>("double", size, maxThreads);
+    perfomTest<int>("int", size, maxThreads);
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
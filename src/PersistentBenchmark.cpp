@@ -0,0 +1,74 @@
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "PersistentVector.h"
+#include "Vector.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+using Persistent = aisdi::PersistentVector<int>;
+
+void perfomTest(std::size_t size, std::size_t versions)
+{
+    Persistent base;
+    const double persistentBuildMs = measureMs([&]
+    {
+        for(std::size_t i = 0; i < size; ++i)
+            base = base.append(static_cast<int>(i));
+    });
+    Persistent batched;
+    const double transientBuildMs = measureMs([&]
+    {
+        Persistent::Transient batch = Persistent().transient();
+        for(std::size_t i = 0; i < size; ++i)
+            batch.append(static_cast<int>(i));
+        batched = batch.persistent();
+    });
+
+    //Every version differs from the previous one by a single update
+    const std::ptrdiff_t baseBytes = Persistent::getAllocatedBytes();
+    std::vector<Persistent> history(1, base);
+    const double persistentMs = measureMs([&]
+    {
+        for(std::size_t v = 1; v < versions; ++v)
+            history.push_back(history.back().set((v * 7919) % size, static_cast<int>(v)));
+    });
+    const double persistentBytes = static_cast<double>(Persistent::getAllocatedBytes() - baseBytes) / (versions - 1);
+
+    std::vector<aisdi::Vector<int>> copies(1, aisdi::Vector<int>());
+    copies[0].resize(size);
+    const double copyMs = measureMs([&]
+    {
+        for(std::size_t v = 1; v < versions; ++v)
+        {
+            copies.push_back(copies.back());
+            copies.back().data()[(v * 7919) % size] = static_cast<int>(v);
+        }
+    });
+    const double copyBytes = static_cast<double>(size * sizeof(int));
+
+    std::cout << size << " ints, " << versions << " versions (height " << base.getHeight() << ")" << std::endl
+              << std::fixed << std::setprecision(1)
+              << "build by append:     persistent " << persistentBuildMs << " ms, transient " << transientBuildMs << " ms" << std::endl
+              << "bytes per version:   persistent " << persistentBytes << ", full copy " << copyBytes << std::endl
+              << "time for versions:   persistent " << persistentMs << " ms, full copy " << copyMs << " ms" << std::endl;
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const std::size_t size = argc > 1 ? std::atoll(argv[1]) : 1000000;
+    const std::size_t versions = argc > 2 ? std::atoll(argv[2]) : 200;
+
+    perfomTest(size, versions);
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,257 @@
+#ifndef AISDI_LINEAR_PERSISTENTLIST_H
+#define AISDI_LINEAR_PERSISTENTLIST_H
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+namespace aisdi
+{
+
+//Immutable singly linked list. prepend() and getRest() return new lists that share all
+//following nodes with the original through reference counting, so copying (forking a
+//history), prepending and dropping the first element are all O(1).
+//Nodes are released in a loop rather than recursively, so dropping the last reference to
+//a long chain cannot overflow the stack.
+template <typename Type>
+class PersistentList
+{
+public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using const_pointer = const Type*;
+    using const_reference = const Type&;
+
+    class ConstIterator;
+    using const_iterator = ConstIterator;
+
+private:
+    struct Node
+    {
+        std::atomic<size_type> references;
+        const value_type data;
+        Node* next; //Owns one reference to the following node
+        const size_type size; //Number of nodes from this one to the end of the list
+
+        Node(const value_type& d, Node* n) : references(1), data(d), next(n), size(n ? n->size + 1 : 1)
+        {}
+    };
+
+    Node* head; //nullptr for an empty list
+
+    explicit PersistentList(Node* h) : head(h)
+    {}
+
+    static Node* retain(Node* node)
+    {
+        if(node) node->references.fetch_add(1, std::memory_order_relaxed);
+        return node;
+    }
+
+    //Drop one reference to *node*, then walk down the chain for as long as that was the last one
+    static void release(Node* node)
+    {
+        while(node && node->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+public:
+    PersistentList() : head(nullptr)
+    {}
+
+    PersistentList(std::initializer_list<Type> l) : head(nullptr)
+    {
+        for(auto it = l.end(); it != l.begin();)
+            head = new Node(*--it, head);
+    }
+
+    //Share *other*'s nodes
+    PersistentList(const PersistentList& other) : head(retain(other.head))
+    {}
+
+    PersistentList(PersistentList&& other) : head(other.head)
+    {
+        other.head = nullptr;
+    }
+
+    ~PersistentList()
+    {
+        release(head);
+    }
+
+    friend void swap(PersistentList& first, PersistentList& second)
+    {
+        using std::swap;
+        swap(first.head, second.head);
+    }
+
+    PersistentList& operator=(PersistentList other)
+    {
+        swap(*this, other);
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return head == nullptr;
+    }
+
+    size_type getSize() const
+    {
+        return head ? head->size : 0;
+    }
+
+    const_reference getFirst() const
+    {
+        if(isEmpty()) throw std::logic_error("List is empty");
+        return head->data;
+    }
+
+    //The list without its first element, sharing all nodes with *this*
+    PersistentList getRest() const
+    {
+        if(isEmpty()) throw std::logic_error("List is empty");
+        return PersistentList(retain(head->next));
+    }
+
+    //*item* followed by all elements of *this*
+    PersistentList prepend(const Type& item) const
+    {
+        return PersistentList(new Node(item, retain(head)));
+    }
+
+    //The list without its first *count* elements
+    PersistentList drop(size_type count) const
+    {
+        if(count > getSize()) throw std::out_of_range("Index out of range");
+        Node* node = head;
+        for(; count > 0; --count)
+            node = node->next;
+        return PersistentList(retain(node));
+    }
+
+    //New list with the elements in opposite order; nothing is shared with *this*
+    PersistentList reverse() const
+    {
+        Node* result = nullptr;
+        for(Node* node = head; node; node = node->next)
+            result = new Node(node->data, result);
+        return PersistentList(result);
+    }
+
+    //*this* followed by *other*. Only *this*'s nodes are copied, *other* is shared as the tail
+    PersistentList concat(const PersistentList& other) const
+    {
+        std::vector<const Node*> nodes;
+        nodes.reserve(getSize());
+        for(const Node* node = head; node; node = node->next)
+            nodes.push_back(node);
+        Node* result = retain(other.head);
+        for(auto it = nodes.rbegin(); it != nodes.rend(); ++it)
+            result = new Node((*it)->data, result);
+        return PersistentList(result);
+    }
+
+    //True when *this* is a suffix of *other* made of the very same nodes
+    bool isSuffixOf(const PersistentList& other) const
+    {
+        if(getSize() > other.getSize()) return false;
+        return other.drop(other.getSize() - getSize()).head == head;
+    }
+
+    template <typename Function>
+    void forEach(Function f) const
+    {
+        for(const Node* node = head; node; node = node->next)
+            f(node->data);
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(head);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(nullptr);
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+};
+
+//Forward only: nodes have no link to their predecessors, which may differ between versions
+template <typename Type>
+class PersistentList<Type>::ConstIterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename PersistentList::value_type;
+    using difference_type = typename PersistentList::difference_type;
+    using pointer = typename PersistentList::const_pointer;
+    using reference = typename PersistentList::const_reference;
+
+private:
+    const Node* element;
+
+public:
+    explicit ConstIterator(const Node* node = nullptr) : element(node)
+    {}
+
+    reference operator*() const
+    {
+        if(!element) throw std::out_of_range("Iterator points at empty space after the last element");
+        return element->data;
+    }
+
+    ConstIterator& operator++()
+    {
+        if(!element) throw std::out_of_range("Cannot increment iterator");
+        element = element->next;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        ConstIterator temp = *this;
+        for(; d > 0; --d)
+            ++temp;
+        return temp;
+    }
+
+    bool operator==(const ConstIterator& other) const
+    {
+        return element == other.element;
+    }
+
+    bool operator!=(const ConstIterator& other) const
+    {
+        return element != other.element;
+    }
+};
+
+}
+
+#endif // AISDI_LINEAR_PERSISTENTLIST_H
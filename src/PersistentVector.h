@@ -0,0 +1,663 @@
+#ifndef AISDI_LINEAR_PERSISTENTVECTOR_H
+#define AISDI_LINEAR_PERSISTENTVECTOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace aisdi
+{
+
+//Immutable vector stored as a relaxed radix-balanced (RRB) tree of 32-way nodes.
+//append(), set() and concat() leave the vector untouched and return a new version that
+//shares all nodes off the modified path with it, so keeping many versions costs
+//O(log n) memory per version instead of a full copy.
+//Every inner node keeps the cumulative sizes of its children. In a balanced subtree the
+//radix digit of the index is already the right child; in a relaxed one (left by concat)
+//the digit is a lower bound and the size table finishes the search.
+//A Transient edits a private copy in place for fast batch construction.
+template <typename Type>
+class PersistentVector
+{
+public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using const_pointer = const Type*;
+    using const_reference = const Type&;
+
+    class Transient;
+    class ConstIterator;
+    using const_iterator = ConstIterator;
+
+    static const unsigned BITS = 5;
+    static const size_type BRANCHING = size_type(1) << BITS;
+
+private:
+    static const size_type MASK = BRANCHING - 1;
+
+    struct Node
+    {
+        std::atomic<size_type> references;
+        std::uint64_t owner; //Transient allowed to modify the node in place, 0 for none
+        unsigned count; //Number of items or children
+        bool leaf;
+
+        Node(std::uint64_t o, bool l) : references(1), owner(o), count(0), leaf(l)
+        {}
+    };
+
+    struct Leaf : Node
+    {
+        value_type items[BRANCHING];
+
+        explicit Leaf(std::uint64_t o) : Node(o, true)
+        {
+            allocatedBytes() += sizeof(Leaf);
+        }
+
+        ~Leaf()
+        {
+            allocatedBytes() -= sizeof(Leaf);
+        }
+    };
+
+    struct Inner : Node
+    {
+        Node* children[BRANCHING];
+        size_type sizes[BRANCHING]; //sizes[i] is the number of items in children [0, i]
+
+        explicit Inner(std::uint64_t o) : Node(o, false)
+        {
+            allocatedBytes() += sizeof(Inner);
+        }
+
+        ~Inner()
+        {
+            allocatedBytes() -= sizeof(Inner);
+        }
+    };
+
+    //Root, size and height of one version; the operations edit it in place, copying every
+    //node that is not owned by *owner*
+    struct Tree
+    {
+        Node* root;
+        size_type size;
+        unsigned height; //0 when the root is a leaf
+
+        Tree() : root(nullptr), size(0), height(0)
+        {}
+
+        Tree(const Tree& other) : root(other.root), size(other.size), height(other.height)
+        {
+            retain(root);
+        }
+
+        ~Tree()
+        {
+            release(root);
+        }
+
+        friend void swap(Tree& first, Tree& second)
+        {
+            std::swap(first.root, second.root);
+            std::swap(first.size, second.size);
+            std::swap(first.height, second.height);
+        }
+
+        Tree& operator=(Tree other)
+        {
+            swap(*this, other);
+            return *this;
+        }
+
+        const Leaf* leafFor(size_type index, size_type& leafStart) const
+        {
+            const Node* node = root;
+            leafStart = index;
+            for(unsigned h = height; h > 0; --h)
+            {
+                const Inner* inner = static_cast<const Inner*>(node);
+                size_type child = childIndex(inner, h, leafStart);
+                if(child) leafStart -= inner->sizes[child - 1];
+                node = inner->children[child];
+            }
+            leafStart = index - leafStart;
+            return static_cast<const Leaf*>(node);
+        }
+
+        void set(size_type index, const Type& value, std::uint64_t owner)
+        {
+            Node* updated = update(root, height, index, value, owner);
+            if(updated != root)
+            {
+                release(root);
+                root = updated;
+            }
+        }
+
+        void append(const Type& value, std::uint64_t owner)
+        {
+            if(!root) root = newPath(0, value, owner);
+            else
+            {
+                Node* pushed = pushBack(root, height, value, owner);
+                if(pushed && pushed != root)
+                {
+                    release(root);
+                    root = pushed;
+                }
+                else if(!pushed)
+                {
+                    //The tree is full, it grows by one level
+                    Inner* top = new Inner(owner);
+                    top->children[0] = root;
+                    top->sizes[0] = size;
+                    top->children[1] = newPath(height, value, owner);
+                    top->sizes[1] = size + 1;
+                    top->count = 2;
+                    root = top;
+                    ++height;
+                }
+            }
+            ++size;
+        }
+    };
+
+    Tree tree;
+
+    static std::atomic<std::ptrdiff_t>& allocatedBytes()
+    {
+        static std::atomic<std::ptrdiff_t> bytes(0);
+        return bytes;
+    }
+
+    static void retain(Node* node)
+    {
+        if(node) node->references.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void release(Node* node)
+    {
+        if(!node || node->references.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+        if(node->leaf)
+        {
+            delete static_cast<Leaf*>(node);
+            return;
+        }
+        Inner* inner = static_cast<Inner*>(node);
+        for(unsigned i = 0; i < inner->count; ++i)
+            release(inner->children[i]);
+        delete inner;
+    }
+
+    static size_type sizeOf(const Node* node)
+    {
+        return node->leaf ? node->count : static_cast<const Inner*>(node)->sizes[node->count - 1];
+    }
+
+    static size_type childIndex(const Inner* inner, unsigned height, size_type index)
+    {
+        size_type child = (index >> (height * BITS)) & MASK;
+        while(inner->sizes[child] <= index)
+            ++child;
+        return child;
+    }
+
+    //*node* itself when the transient *owner* may modify it, otherwise a copy owned by *owner*
+    static Leaf* editableLeaf(Node* node, std::uint64_t owner)
+    {
+        if(owner && node->owner == owner) return static_cast<Leaf*>(node);
+        const Leaf* leaf = static_cast<const Leaf*>(node);
+        Leaf* copy = new Leaf(owner);
+        copy->count = leaf->count;
+        for(unsigned i = 0; i < leaf->count; ++i)
+            copy->items[i] = leaf->items[i];
+        return copy;
+    }
+
+    static Inner* editableInner(Node* node, std::uint64_t owner)
+    {
+        if(owner && node->owner == owner) return static_cast<Inner*>(node);
+        const Inner* inner = static_cast<const Inner*>(node);
+        Inner* copy = new Inner(owner);
+        copy->count = inner->count;
+        for(unsigned i = 0; i < inner->count; ++i)
+        {
+            copy->children[i] = inner->children[i];
+            copy->sizes[i] = inner->sizes[i];
+            retain(copy->children[i]);
+        }
+        return copy;
+    }
+
+    static void replaceChild(Inner* inner, unsigned i, Node* child)
+    {
+        if(inner->children[i] == child) return;
+        release(inner->children[i]);
+        inner->children[i] = child;
+    }
+
+    //Chain of single-child nodes of the given height ending in a leaf holding *value*
+    static Node* newPath(unsigned height, const Type& value, std::uint64_t owner)
+    {
+        Leaf* leaf = new Leaf(owner);
+        leaf->items[0] = value;
+        leaf->count = 1;
+        Node* node = leaf;
+        for(unsigned h = 0; h < height; ++h)
+        {
+            Inner* inner = new Inner(owner);
+            inner->children[0] = node;
+            inner->sizes[0] = 1;
+            inner->count = 1;
+            node = inner;
+        }
+        return node;
+    }
+
+    static Node* update(Node* node, unsigned height, size_type index, const Type& value, std::uint64_t owner)
+    {
+        if(height == 0)
+        {
+            Leaf* leaf = editableLeaf(node, owner);
+            leaf->items[index] = value;
+            return leaf;
+        }
+        Inner* inner = editableInner(node, owner);
+        const size_type child = childIndex(inner, height, index);
+        const size_type offset = child ? inner->sizes[child - 1] : 0;
+        replaceChild(inner, child, update(inner->children[child], height - 1, index - offset, value, owner));
+        return inner;
+    }
+
+    //Node with *value* appended to the rightmost leaf, or nullptr when the subtree is full
+    static Node* pushBack(Node* node, unsigned height, const Type& value, std::uint64_t owner)
+    {
+        if(height == 0)
+        {
+            if(node->count == BRANCHING) return nullptr;
+            Leaf* leaf = editableLeaf(node, owner);
+            leaf->items[leaf->count++] = value;
+            return leaf;
+        }
+        Inner* inner = static_cast<Inner*>(node);
+        const unsigned last = inner->count - 1;
+        Node* pushed = pushBack(inner->children[last], height - 1, value, owner);
+        if(!pushed && inner->count == BRANCHING) return nullptr;
+
+        Inner* edited = editableInner(node, owner);
+        if(pushed)
+        {
+            replaceChild(edited, last, pushed);
+            ++edited->sizes[last];
+        }
+        else
+        {
+            edited->children[last + 1] = newPath(height - 1, value, owner);
+            edited->sizes[last + 1] = edited->sizes[last] + 1;
+            ++edited->count;
+        }
+        return edited;
+    }
+
+    //Inner nodes holding *children* (each with its own reference) in order, BRANCHING per node
+    static void pack(const std::vector<Node*>& children, std::vector<Node*>& out)
+    {
+        for(size_type first = 0; first < children.size(); first += BRANCHING)
+        {
+            Inner* inner = new Inner(0);
+            size_type total = 0;
+            for(size_type i = first; i < children.size() && i < first + BRANCHING; ++i)
+            {
+                inner->children[inner->count] = children[i];
+                total += sizeOf(children[i]);
+                inner->sizes[inner->count++] = total;
+            }
+            out.push_back(inner);
+        }
+    }
+
+    //Concatenate the subtrees along the seam: the rightmost path of *left* and the leftmost
+    //path of *right* are merged level by level and the children around the seam are repacked,
+    //so the result has at most two nodes of the taller height and all other nodes are shared
+    static void concatNodes(Node* left, unsigned leftHeight, Node* right, unsigned rightHeight, std::vector<Node*>& out)
+    {
+        if(leftHeight == 0 && rightHeight == 0)
+        {
+            const Leaf* l = static_cast<const Leaf*>(left);
+            const Leaf* r = static_cast<const Leaf*>(right);
+            if(l->count + r->count <= BRANCHING)
+            {
+                Leaf* merged = editableLeaf(left, 0);
+                for(unsigned i = 0; i < r->count; ++i)
+                    merged->items[merged->count++] = r->items[i];
+                out.push_back(merged);
+                return;
+            }
+            //Fill the left leaf up, the rest of the right one stays in a second leaf
+            Leaf* full = editableLeaf(left, 0);
+            Leaf* rest = new Leaf(0);
+            unsigned i = 0;
+            for(; full->count < BRANCHING; ++i)
+                full->items[full->count++] = r->items[i];
+            for(; i < r->count; ++i)
+                rest->items[rest->count++] = r->items[i];
+            out.push_back(full);
+            out.push_back(rest);
+            return;
+        }
+
+        std::vector<Node*> children, middle;
+        const unsigned height = leftHeight > rightHeight ? leftHeight : rightHeight;
+        const Inner* l = leftHeight == height ? static_cast<const Inner*>(left) : nullptr;
+        const Inner* r = rightHeight == height ? static_cast<const Inner*>(right) : nullptr;
+        concatNodes(l ? l->children[l->count - 1] : left, l ? leftHeight - 1 : leftHeight,
+                    r ? r->children[0] : right, r ? rightHeight - 1 : rightHeight, middle);
+        if(l)
+            for(unsigned i = 0; i + 1 < l->count; ++i)
+            {
+                retain(l->children[i]);
+                children.push_back(l->children[i]);
+            }
+        children.insert(children.end(), middle.begin(), middle.end());
+        if(r)
+            for(unsigned i = 1; i < r->count; ++i)
+            {
+                retain(r->children[i]);
+                children.push_back(r->children[i]);
+            }
+        pack(children, out);
+    }
+
+    explicit PersistentVector(const Tree& t) : tree(t)
+    {}
+
+public:
+    PersistentVector()
+    {}
+
+    PersistentVector(std::initializer_list<Type> l)
+    {
+        Transient batch = transient();
+        for(const value_type& item : l)
+            batch.append(item);
+        *this = batch.persistent();
+    }
+
+    bool isEmpty() const
+    {
+        return tree.size == 0;
+    }
+
+    size_type getSize() const
+    {
+        return tree.size;
+    }
+
+    //Number of inner levels above the leaves
+    unsigned getHeight() const
+    {
+        return tree.height;
+    }
+
+    //Bytes taken by all live nodes of all PersistentVectors of this element type
+    static std::ptrdiff_t getAllocatedBytes()
+    {
+        return allocatedBytes().load();
+    }
+
+    const_reference operator[](size_type index) const
+    {
+        if(index >= tree.size) throw std::out_of_range("Index out of range");
+        size_type leafStart;
+        return tree.leafFor(index, leafStart)->items[index - leafStart];
+    }
+
+    PersistentVector set(size_type index, const Type& value) const
+    {
+        if(index >= tree.size) throw std::out_of_range("Index out of range");
+        Tree result(tree);
+        result.set(index, value, 0);
+        return PersistentVector(result);
+    }
+
+    PersistentVector append(const Type& value) const
+    {
+        Tree result(tree);
+        result.append(value, 0);
+        return PersistentVector(result);
+    }
+
+    //All items of *this* followed by all items of *other*
+    PersistentVector concat(const PersistentVector& other) const
+    {
+        if(other.isEmpty()) return *this;
+        if(isEmpty()) return other;
+        std::vector<Node*> nodes;
+        concatNodes(tree.root, tree.height, other.tree.root, other.tree.height, nodes);
+
+        Tree result;
+        result.size = tree.size + other.tree.size;
+        result.height = tree.height > other.tree.height ? tree.height : other.tree.height;
+        if(nodes.size() == 1) result.root = nodes[0];
+        else
+        {
+            std::vector<Node*> top;
+            pack(nodes, top);
+            result.root = top[0];
+            ++result.height;
+        }
+        return PersistentVector(result);
+    }
+
+    //Mutable copy for batch edits; only nodes it creates itself are modified in place
+    Transient transient() const
+    {
+        return Transient(tree);
+    }
+
+    //Call f(item) for every item in order, one leaf at a time
+    template <typename Function>
+    void forEach(Function f) const
+    {
+        for(size_type index = 0; index < tree.size; )
+        {
+            size_type leafStart;
+            const Leaf* leaf = tree.leafFor(index, leafStart);
+            for(unsigned i = 0; i < leaf->count; ++i)
+                f(leaf->items[i]);
+            index = leafStart + leaf->count;
+        }
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(this, tree.size);
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+};
+
+template <typename Type>
+const unsigned PersistentVector<Type>::BITS;
+
+template <typename Type>
+const typename PersistentVector<Type>::size_type PersistentVector<Type>::BRANCHING;
+
+template <typename Type>
+const typename PersistentVector<Type>::size_type PersistentVector<Type>::MASK;
+
+//Editable version of a PersistentVector. Nodes it creates carry its owner id and are changed
+//in place; shared nodes are copied once. persistent() freezes the current contents: the
+//transient switches to a new id, so later edits copy again instead of changing the result.
+template <typename Type>
+class PersistentVector<Type>::Transient
+{
+    friend class PersistentVector<Type>;
+
+    Tree tree;
+    std::uint64_t owner;
+
+    static std::uint64_t nextOwner()
+    {
+        static std::atomic<std::uint64_t> owners(0);
+        return ++owners;
+    }
+
+    explicit Transient(const Tree& t) : tree(t), owner(nextOwner())
+    {}
+
+public:
+    //Two transients must never share an owner id, so a moved-from one gets a new id
+    Transient(Transient&& other) : tree(other.tree), owner(other.owner)
+    {
+        other.owner = nextOwner();
+    }
+
+    Transient(const Transient&) = delete;
+    Transient& operator=(const Transient&) = delete;
+
+    bool isEmpty() const
+    {
+        return tree.size == 0;
+    }
+
+    size_type getSize() const
+    {
+        return tree.size;
+    }
+
+    const_reference operator[](size_type index) const
+    {
+        if(index >= tree.size) throw std::out_of_range("Index out of range");
+        size_type leafStart;
+        return tree.leafFor(index, leafStart)->items[index - leafStart];
+    }
+
+    void set(size_type index, const Type& value)
+    {
+        if(index >= tree.size) throw std::out_of_range("Index out of range");
+        tree.set(index, value, owner);
+    }
+
+    void append(const Type& value)
+    {
+        tree.append(value, owner);
+    }
+
+    PersistentVector persistent()
+    {
+        owner = nextOwner();
+        return PersistentVector(tree);
+    }
+};
+
+//Bidirectional iterator that remembers the current leaf, so stepping through a leaf is O(1)
+template <typename Type>
+class PersistentVector<Type>::ConstIterator
+{
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename PersistentVector::value_type;
+    using difference_type = typename PersistentVector::difference_type;
+    using pointer = typename PersistentVector::const_pointer;
+    using reference = typename PersistentVector::const_reference;
+
+private:
+    const PersistentVector<Type>* parent_vec;
+    size_type index;
+    mutable const Leaf* leaf;
+    mutable size_type leafStart;
+
+public:
+    explicit ConstIterator() : parent_vec(nullptr), index(0), leaf(nullptr), leafStart(0)
+    {}
+
+    ConstIterator(const PersistentVector<Type>* parent, size_type i) : parent_vec(parent), index(i), leaf(nullptr),
+                    leafStart(0)
+    {}
+
+    reference operator*() const
+    {
+        if(index >= parent_vec->getSize()) throw std::out_of_range("Iterator points at empty space after the last element");
+        if(!leaf || index < leafStart || index >= leafStart + leaf->count)
+            leaf = parent_vec->tree.leafFor(index, leafStart);
+        return leaf->items[index - leafStart];
+    }
+
+    ConstIterator& operator++()
+    {
+        if(index >= parent_vec->getSize()) throw std::out_of_range("Cannot increment iterator");
+        ++index;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    ConstIterator& operator--()
+    {
+        if(index == 0) throw std::out_of_range("Cannot decrement iterator");
+        --index;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        ConstIterator temp(*this);
+        temp.index += d;
+        return temp;
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        ConstIterator temp(*this);
+        temp.index -= d;
+        return temp;
+    }
+
+    bool operator==(const ConstIterator& other) const
+    {
+        return parent_vec == other.parent_vec && index == other.index;
+    }
+
+    bool operator!=(const ConstIterator& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+}
+
+#endif // AISDI_LINEAR_PERSISTENTVECTOR_H
@@ -0,0 +1,267 @@
+#ifndef AISDI_LINEAR_PRIORITYQUEUE_H
+#define AISDI_LINEAR_PRIORITYQUEUE_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+
+#include "Vector.h"
+
+namespace aisdi
+{
+
+//Priority queue kept as an implicit d-ary heap in a Vector. top() is an element no other
+//element compares less than. With *Arity* 4 or 8 the heap is two or three times shallower
+//than a binary one, and the children compared at each level of a sift-down sit next to
+//each other in memory.
+//Every element gets a Handle, which stays valid while the element is queued, so its priority
+//can be changed (decrease-key) or it can be removed in O(log n). Handle ids are reused, so
+//a handle also carries the generation of its id and one of a popped element is rejected.
+template <typename Type, typename Compare = std::less<Type>, std::size_t Arity = 4>
+class PriorityQueue
+{
+    static_assert(Arity >= 2, "A heap needs at least two children per node");
+
+public:
+    using size_type = std::size_t;
+    using value_type = Type;
+    using const_reference = const Type&;
+
+    struct Handle
+    {
+        size_type id;
+        size_type generation;
+
+        explicit Handle(size_type i = NONE, size_type g = 0) : id(i), generation(g)
+        {}
+
+        bool operator==(const Handle& other) const
+        {
+            return id == other.id && generation == other.generation;
+        }
+
+        bool operator!=(const Handle& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    static const size_type NONE = static_cast<size_type>(-1);
+
+private:
+    struct Entry
+    {
+        value_type value;
+        size_type id;
+    };
+
+    struct Slot
+    {
+        size_type position; //Index in *heap*, NONE when the id is not queued
+        size_type generation; //Incremented whenever the element with the id leaves the queue
+    };
+
+    Vector<Entry> heap;
+    Vector<Slot> positions; //Indexed by handle id
+    Vector<size_type> freeIds;
+    Compare less;
+
+    void place(size_type position, const Entry& entry)
+    {
+        heap.data()[position] = entry;
+        positions.data()[entry.id].position = position;
+    }
+
+    //Move *entry* from the hole at *position* towards the root
+    void siftUp(size_type position, const Entry& entry)
+    {
+        Entry* items = heap.data();
+        while(position > 0)
+        {
+            const size_type parent = (position - 1) / Arity;
+            if(!less(entry.value, items[parent].value)) break;
+            place(position, items[parent]);
+            position = parent;
+        }
+        place(position, entry);
+    }
+
+    //Move *entry* from the hole at *position* towards the leaves
+    void siftDown(size_type position, const Entry& entry)
+    {
+        Entry* items = heap.data();
+        const size_type size = heap.getSize();
+        for(;;)
+        {
+            const size_type first = Arity * position + 1;
+            if(first >= size) break;
+            const size_type last = first + Arity < size ? first + Arity : size;
+            size_type best = first;
+            for(size_type child = first + 1; child < last; ++child)
+                if(less(items[child].value, items[best].value)) best = child;
+            if(!less(items[best].value, entry.value)) break;
+            place(position, items[best]);
+            position = best;
+        }
+        place(position, entry);
+    }
+
+    size_type newId()
+    {
+        if(!freeIds.isEmpty()) return freeIds.popLast();
+        positions.append(Slot{ NONE, 0 });
+        return positions.getSize() - 1;
+    }
+
+    size_type positionOf(const Handle& handle) const
+    {
+        if(!contains(handle)) throw std::out_of_range("Invalid handle");
+        return positions.data()[handle.id].position;
+    }
+
+    //Mark *id* as no longer queued, invalidating its handles
+    void release(size_type id)
+    {
+        Slot& slot = positions.data()[id];
+        slot.position = NONE;
+        ++slot.generation;
+    }
+
+    //Take the entry at *position* out of the heap
+    void removeAt(size_type position)
+    {
+        const size_type id = heap.data()[position].id;
+        release(id);
+        freeIds.append(id);
+        const Entry last = heap.popLast();
+        if(position == heap.getSize()) return;
+        if(position > 0 && less(last.value, heap.data()[(position - 1) / Arity].value)) siftUp(position, last);
+        else siftDown(position, last);
+    }
+
+public:
+    explicit PriorityQueue(const Compare& comp = Compare()) : less(comp)
+    {}
+
+    PriorityQueue(std::initializer_list<Type> l, const Compare& comp = Compare()) : less(comp)
+    {
+        Vector<Type> values;
+        values.reserve(l.size());
+        for(const value_type& item : l)
+            values.append(item);
+        heapify(values);
+    }
+
+    bool isEmpty() const
+    {
+        return heap.isEmpty();
+    }
+
+    size_type getSize() const
+    {
+        return heap.getSize();
+    }
+
+    void reserve(size_type count)
+    {
+        heap.reserve(count);
+        positions.reserve(count);
+    }
+
+    //Replace the contents with *values* in O(n); the i-th value gets the id i, see handleOf.
+    //Handles to the previous contents become invalid.
+    void heapify(const Vector<Type>& values)
+    {
+        const size_type size = values.getSize();
+        for(size_type i = 0; i < heap.getSize(); ++i)
+            release(heap.data()[i].id);
+        heap.resize(size);
+        freeIds.resize(0);
+        for(size_type id = positions.getSize(); id-- > size;)
+            freeIds.append(id);
+        while(positions.getSize() < size)
+            positions.append(Slot{ NONE, 0 });
+        for(size_type i = 0; i < size; ++i)
+            place(i, Entry{ values.data()[i], i });
+        for(size_type i = size > 1 ? (size - 2) / Arity + 1 : 0; i-- > 0;)
+        {
+            const Entry entry = heap.data()[i];
+            siftDown(i, entry);
+        }
+    }
+
+    Handle push(const Type& item)
+    {
+        const size_type id = newId();
+        const Entry entry{ item, id }; //*item* may live in the heap that append() reallocates
+        heap.append(entry);
+        siftUp(heap.getSize() - 1, entry);
+        return Handle(id, positions.data()[id].generation);
+    }
+
+    //Handle of the *index*-th value passed to the last heapify, valid while that value is queued
+    Handle handleOf(size_type index) const
+    {
+        if(index >= positions.getSize()) throw std::out_of_range("Index out of range");
+        return Handle(index, positions.data()[index].generation);
+    }
+
+    const_reference top() const
+    {
+        if(isEmpty()) throw std::logic_error("Queue is empty");
+        return heap.data()[0].value;
+    }
+
+    value_type pop()
+    {
+        if(isEmpty()) throw std::logic_error("Queue is empty");
+        value_type temp = heap.data()[0].value;
+        removeAt(0);
+        return temp;
+    }
+
+    //Pop up to *count* elements, in priority order
+    Vector<Type> popN(size_type count)
+    {
+        Vector<Type> result;
+        if(count > getSize()) count = getSize();
+        result.reserve(count);
+        for(size_type i = 0; i < count; ++i)
+            result.append(pop());
+        return result;
+    }
+
+    //True while the element of *handle* is queued
+    bool contains(const Handle& handle) const
+    {
+        return handle.id < positions.getSize() && positions.data()[handle.id].position != NONE
+               && positions.data()[handle.id].generation == handle.generation;
+    }
+
+    const_reference get(const Handle& handle) const
+    {
+        return heap.data()[positionOf(handle)].value;
+    }
+
+    //Give the element of *handle* a new value, moving it up or down as needed
+    void update(const Handle& handle, const Type& item)
+    {
+        const size_type position = positionOf(handle);
+        const Entry entry{ item, handle.id };
+        if(less(item, heap.data()[position].value)) siftUp(position, entry);
+        else siftDown(position, entry);
+    }
+
+    void erase(const Handle& handle)
+    {
+        removeAt(positionOf(handle));
+    }
+};
+
+template <typename Type, typename Compare, std::size_t Arity>
+const typename PriorityQueue<Type, Compare, Arity>::size_type PriorityQueue<Type, Compare, Arity>::NONE;
+
+}
+
+#endif // AISDI_LINEAR_PRIORITYQUEUE_H
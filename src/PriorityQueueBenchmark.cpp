@@ -0,0 +1,124 @@
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <queue>
+#include <string>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "PriorityQueue.h"
+#include "Vector.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+
+std::vector<int> randomItems(std::size_t count)
+{
+    std::vector<int> items(count);
+    unsigned seed = 2016;
+    for(int& item : items)
+    {
+        seed = seed * 1103515245u + 12345u;
+        item = static_cast<int>(seed >> 1);
+    }
+    return items;
+}
+
+void printRow(const std::string& name, double pushMs, double popMs, long checksum, long expected)
+{
+    std::cout << std::left << std::setw(26) << name << std::right << std::fixed << std::setprecision(1)
+              << "push " << std::setw(8) << pushMs << " ms, pop " << std::setw(8) << popMs << " ms" << std::endl;
+    if(checksum != expected) std::cout << "Results differ!" << std::endl;
+}
+
+template <std::size_t Arity>
+long measureHeap(const std::vector<int>& items, long expected)
+{
+    aisdi::PriorityQueue<int, std::less<int>, Arity> queue;
+    queue.reserve(items.size());
+    long checksum = 0;
+    const double pushMs = measureMs([&]
+    {
+        for(int item : items)
+            queue.push(item);
+    });
+    const double popMs = measureMs([&]
+    {
+        for(long order = 0; !queue.isEmpty(); ++order)
+            checksum += queue.pop() % 1000 * (order % 7);
+    });
+    printRow("PriorityQueue, arity " + std::to_string(Arity), pushMs, popMs, checksum, expected);
+    return checksum;
+}
+
+//What the hand-written queues did: insert at a binary-searched position of a sorted Vector
+void measureSortedVector(const std::vector<int>& items)
+{
+    aisdi::Vector<int> sorted;
+    const double pushMs = measureMs([&]
+    {
+        for(int item : items)
+        {
+            const int* data = sorted.data();
+            std::size_t low = 0, high = sorted.getSize();
+            while(low < high)
+            {
+                const std::size_t middle = (low + high) / 2;
+                if(data[middle] > item) low = middle + 1;
+                else high = middle;
+            }
+            sorted.insert(sorted.begin() + low, item);
+        }
+    });
+    const double popMs = measureMs([&]
+    {
+        while(!sorted.isEmpty())
+            sorted.popLast();
+    });
+    printRow("sorted Vector (" + std::to_string(items.size()) + ")", pushMs, popMs, 0, 0);
+}
+
+void perfomTest(std::size_t count, std::size_t sortedCount)
+{
+    const std::vector<int> items = randomItems(count);
+    std::cout << count << " pushes followed by " << count << " pops" << std::endl;
+
+    std::priority_queue<int, std::vector<int>, std::greater<int>> reference;
+    long expected = 0;
+    const double pushMs = measureMs([&]
+    {
+        for(int item : items)
+            reference.push(item);
+    });
+    const double popMs = measureMs([&]
+    {
+        for(long order = 0; !reference.empty(); ++order)
+        {
+            expected += reference.top() % 1000 * (order % 7);
+            reference.pop();
+        }
+    });
+    printRow("std::priority_queue", pushMs, popMs, expected, expected);
+
+    measureHeap<2>(items, expected);
+    measureHeap<4>(items, expected);
+    measureHeap<8>(items, expected);
+    measureSortedVector(std::vector<int>(items.begin(), items.begin() + std::min(sortedCount, count)));
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const std::size_t count = argc > 1 ? std::atoll(argv[1]) : 1000000;
+    const std::size_t sortedCount = argc > 2 ? std::atoll(argv[2]) : 20000;
+
+    perfomTest(count, sortedCount);
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,270 @@
+#ifndef AISDI_LINEAR_SERIALIZATION_H
+#define AISDI_LINEAR_SERIALIZATION_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+
+#include "LinkedList.h"
+#include "Span.h"
+#include "Vector.h"
+
+namespace aisdi
+{
+namespace serialization
+{
+
+//Binary checkpoint format, native byte order:
+//  64-byte header (magic, version, collection kind, element size, element count, payload checksum)
+//  element payload, stored contiguously for both Vector and LinkedList.
+//The payload starts 64 bytes into the data, so a mapped file can be read in place.
+
+const std::uint64_t MAGIC = 0x3152455344534941ULL; //"AISDSER1"
+const std::uint32_t FORMAT_VERSION = 1;
+const std::size_t HEADER_SIZE = 64;
+
+enum class Kind : std::uint32_t
+{
+    Vector = 1,
+    LinkedList = 2
+};
+
+struct Header
+{
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t kind;
+    std::uint64_t elementSize;
+    std::uint64_t count;
+    std::uint64_t checksum;
+    char reserved[HEADER_SIZE - 40];
+};
+
+static_assert(sizeof(Header) == HEADER_SIZE, "Header has to fill exactly HEADER_SIZE bytes");
+
+//64-bit FNV-1a style hash consuming eight bytes per step; *seed* continues an earlier hash
+inline std::uint64_t checksum(const void* data, std::size_t bytes, std::uint64_t seed = 0xCBF29CE484222325ULL)
+{
+    const std::uint64_t prime = 0x100000001B3ULL;
+    const char* p = static_cast<const char*>(data);
+    std::uint64_t hash = seed;
+    for(; bytes >= 8; bytes -= 8, p += 8)
+    {
+        std::uint64_t word;
+        std::memcpy(&word, p, 8);
+        hash = (hash ^ word) * prime;
+    }
+    for(; bytes > 0; --bytes, ++p)
+        hash = (hash ^ static_cast<unsigned char>(*p)) * prime;
+    return hash;
+}
+
+namespace detail
+{
+
+const std::size_t LIST_BUFFER_ELEMENTS = 4096; //LinkedList elements are written in blocks of this size
+const std::size_t VECTOR_BLOCK_BYTES = 1 << 20; //Vector payloads of unknown length are read in blocks of this size
+
+template <typename Type>
+Header makeHeader(Kind kind, std::uint64_t count, std::uint64_t sum)
+{
+    Header header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = MAGIC;
+    header.version = FORMAT_VERSION;
+    header.kind = static_cast<std::uint32_t>(kind);
+    header.elementSize = sizeof(Type);
+    header.count = count;
+    header.checksum = sum;
+    return header;
+}
+
+template <typename Type>
+void checkHeader(const Header& header, Kind kind)
+{
+    if(header.magic != MAGIC) throw std::runtime_error("Not a serialized collection");
+    if(header.version != FORMAT_VERSION) throw std::runtime_error("Unsupported format version");
+    if(header.kind != static_cast<std::uint32_t>(kind)) throw std::runtime_error("Serialized collection is of another kind");
+    if(header.elementSize != sizeof(Type)) throw std::runtime_error("Serialized elements have another size");
+}
+
+inline void write(std::ostream& out, const void* data, std::size_t bytes)
+{
+    if(!out.write(static_cast<const char*>(data), bytes)) throw std::runtime_error("Cannot write serialized data");
+}
+
+inline void read(std::istream& in, void* data, std::size_t bytes)
+{
+    if(!in.read(static_cast<char*>(data), bytes)) throw std::runtime_error("Serialized data is truncated");
+}
+
+//Bytes left in *in* after the current position, or -1 if the stream cannot tell
+inline std::streamoff remainingBytes(std::istream& in)
+{
+    const std::istream::pos_type here = in.tellg();
+    if(here == std::istream::pos_type(-1)) return -1;
+    in.seekg(0, std::ios::end);
+    const std::istream::pos_type end = in.tellg();
+    in.clear();
+    in.seekg(here);
+    if(end == std::istream::pos_type(-1) || !in) return -1;
+    return end - here;
+}
+
+template <typename Type>
+void checkTriviallyCopyable()
+{
+    static_assert(std::is_trivially_copyable<Type>::value, "Only trivially copyable elements can be serialized");
+}
+
+}
+
+//Write the header and the whole Vector payload with one call each
+template <typename Type>
+void save(std::ostream& out, const Vector<Type>& vector)
+{
+    detail::checkTriviallyCopyable<Type>();
+    const std::size_t bytes = vector.getSize() * sizeof(Type);
+    const Header header = detail::makeHeader<Type>(Kind::Vector, vector.getSize(), checksum(vector.data(), bytes));
+    detail::write(out, &header, sizeof(header));
+    detail::write(out, vector.data(), bytes);
+}
+
+//The list is walked once to count and hash the elements, then written in contiguous blocks
+template <typename Type>
+void save(std::ostream& out, const LinkedList<Type>& list)
+{
+    detail::checkTriviallyCopyable<Type>();
+    std::uint64_t count = 0;
+    std::uint64_t sum = checksum(nullptr, 0);
+    std::unique_ptr<Type[]> buffer(new Type[detail::LIST_BUFFER_ELEMENTS]);
+    std::size_t buffered = 0;
+
+    //Hashing block by block gives the same checksum as hashing the contiguous payload,
+    //because LIST_BUFFER_ELEMENTS is a multiple of eight and so is every full block in bytes
+    for(const Type& item : list)
+    {
+        buffer[buffered++] = item;
+        ++count;
+        if(buffered == detail::LIST_BUFFER_ELEMENTS)
+        {
+            sum = checksum(buffer.get(), buffered * sizeof(Type), sum);
+            buffered = 0;
+        }
+    }
+    sum = checksum(buffer.get(), buffered * sizeof(Type), sum);
+
+    const Header header = detail::makeHeader<Type>(Kind::LinkedList, count, sum);
+    detail::write(out, &header, sizeof(header));
+    buffered = 0;
+    for(const Type& item : list)
+    {
+        buffer[buffered++] = item;
+        if(buffered == detail::LIST_BUFFER_ELEMENTS)
+        {
+            detail::write(out, buffer.get(), buffered * sizeof(Type));
+            buffered = 0;
+        }
+    }
+    detail::write(out, buffer.get(), buffered * sizeof(Type));
+}
+
+//Read a Vector saved by save(); the payload is read straight into the Vector's storage.
+//The element count comes from the data, so it is checked against the length of the stream
+//before anything is allocated. When the stream cannot tell its length, the Vector grows
+//block by block as the payload arrives instead.
+template <typename Type>
+Vector<Type> loadVector(std::istream& in)
+{
+    detail::checkTriviallyCopyable<Type>();
+    Header header;
+    detail::read(in, &header, sizeof(header));
+    detail::checkHeader<Type>(header, Kind::Vector);
+    if(header.count > std::numeric_limits<std::size_t>::max() / sizeof(Type))
+        throw std::runtime_error("Serialized data is truncated");
+    const std::size_t count = header.count;
+    const std::size_t bytes = count * sizeof(Type);
+
+    Vector<Type> vector;
+    const std::streamoff remaining = detail::remainingBytes(in);
+    if(remaining >= 0)
+    {
+        if(static_cast<std::uint64_t>(remaining) < bytes) throw std::runtime_error("Serialized data is truncated");
+        vector.resize(count);
+        detail::read(in, vector.data(), bytes);
+    }
+    else
+    {
+        const std::size_t block = detail::VECTOR_BLOCK_BYTES / sizeof(Type) + 1;
+        for(std::size_t loaded = 0; loaded < count; )
+        {
+            const std::size_t step = count - loaded < block ? count - loaded : block;
+            if(loaded + step > vector.getCapacity())
+                vector.reserve(std::min(count, std::max(loaded + step, 2 * vector.getCapacity())));
+            vector.resize(loaded + step);
+            detail::read(in, vector.data() + loaded, step * sizeof(Type));
+            loaded += step;
+        }
+    }
+    if(checksum(vector.data(), bytes) != header.checksum)
+        throw std::runtime_error("Serialized data is corrupted");
+    return vector;
+}
+
+template <typename Type>
+LinkedList<Type> loadList(std::istream& in)
+{
+    detail::checkTriviallyCopyable<Type>();
+    Header header;
+    detail::read(in, &header, sizeof(header));
+    detail::checkHeader<Type>(header, Kind::LinkedList);
+
+    LinkedList<Type> list;
+    std::unique_ptr<Type[]> buffer(new Type[detail::LIST_BUFFER_ELEMENTS]);
+    std::uint64_t sum = checksum(nullptr, 0);
+    for(std::uint64_t left = header.count; left > 0; )
+    {
+        const std::size_t block = left < detail::LIST_BUFFER_ELEMENTS ? left : detail::LIST_BUFFER_ELEMENTS;
+        detail::read(in, buffer.get(), block * sizeof(Type));
+        sum = checksum(buffer.get(), block * sizeof(Type), sum);
+        for(std::size_t i = 0; i < block; ++i)
+            list.append(buffer[i]);
+        left -= block;
+    }
+    if(sum != header.checksum) throw std::runtime_error("Serialized data is corrupted");
+    return list;
+}
+
+//Elements of a serialized Vector or LinkedList read in place from *buffer* (e.g. a mapped file)
+//without copying. Verifying the checksum reads the payload once; it can be skipped for trusted data.
+template <typename Type>
+Span<const Type> view(const void* buffer, std::size_t bytes, bool verifyChecksum = true)
+{
+    detail::checkTriviallyCopyable<Type>();
+    if(bytes < HEADER_SIZE) throw std::runtime_error("Serialized data is truncated");
+    Header header;
+    std::memcpy(&header, buffer, sizeof(header));
+    //Both kinds share the payload layout, so either can be viewed
+    const bool isList = header.kind == static_cast<std::uint32_t>(Kind::LinkedList);
+    detail::checkHeader<Type>(header, isList ? Kind::LinkedList : Kind::Vector);
+
+    const char* payload = static_cast<const char*>(buffer) + HEADER_SIZE;
+    if(header.count > (bytes - HEADER_SIZE) / sizeof(Type)) throw std::runtime_error("Serialized data is truncated");
+    if(reinterpret_cast<std::uintptr_t>(payload) % alignof(Type) != 0)
+        throw std::runtime_error("Serialized payload is not aligned for its element type");
+    if(verifyChecksum && checksum(payload, header.count * sizeof(Type)) != header.checksum)
+        throw std::runtime_error("Serialized data is corrupted");
+    return Span<const Type>(reinterpret_cast<const Type*>(payload), header.count);
+}
+
+}
+}
+
+#endif // AISDI_LINEAR_SERIALIZATION_H
@@ -0,0 +1,97 @@
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "BenchmarkUtils.h"
+#include "LinkedList.h"
+#include "Serialization.h"
+#include "Vector.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+
+//The format the checkpoints used so far: one element per line
+template <typename Collection>
+void saveText(std::ostream& out, const Collection& collection)
+{
+    out << collection.getSize() << '\n';
+    for(const auto& item : collection)
+        out << item << '\n';
+}
+
+template <typename Collection>
+Collection loadText(std::istream& in)
+{
+    Collection collection;
+    std::size_t size = 0;
+    in >> size;
+    typename Collection::value_type item;
+    for(std::size_t i = 0; i < size && in >> item; ++i)
+        collection.append(item);
+    return collection;
+}
+
+template <typename Collection, typename Load>
+void perfomTest(const char* name, const Collection& collection, Load loadBinary)
+{
+    std::string text, binary;
+    std::size_t loadedText = 0, loadedBinary = 0;
+
+    const double saveTextMs = measureMs([&]
+    {
+        std::ostringstream out;
+        saveText(out, collection);
+        text = out.str();
+    });
+    const double saveBinaryMs = measureMs([&]
+    {
+        std::ostringstream out;
+        aisdi::serialization::save(out, collection);
+        binary = out.str();
+    });
+    const double loadTextMs = measureMs([&]
+    {
+        std::istringstream in(text);
+        loadedText = loadText<Collection>(in).getSize();
+    });
+    const double loadBinaryMs = measureMs([&]
+    {
+        std::istringstream in(binary);
+        loadedBinary = loadBinary(in).getSize();
+    });
+
+    std::cout << name << ": " << collection.getSize() << " ints, " << text.size() << " text bytes, "
+              << binary.size() << " binary bytes (loaded " << loadedText << ", " << loadedBinary << ")" << std::endl
+              << std::fixed << std::setprecision(1)
+              << "  save text:   " << saveTextMs << " ms" << std::endl
+              << "  save binary: " << saveBinaryMs << " ms" << std::endl
+              << "  load text:   " << loadTextMs << " ms" << std::endl
+              << "  load binary: " << loadBinaryMs << " ms" << std::endl;
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const std::size_t size = argc > 1 ? std::atoll(argv[1]) : 5000000;
+
+    aisdi::Vector<int> vector;
+    aisdi::LinkedList<int> list;
+    vector.reserve(size);
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        const int value = static_cast<int>(i * 2654435761u);
+        vector.append(value);
+        list.append(value);
+    }
+
+    perfomTest("Vector", vector, [](std::istream& in) { return aisdi::serialization::loadVector<int>(in); });
+    perfomTest("LinkedList", list, [](std::istream& in) { return aisdi::serialization::loadList<int>(in); });
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
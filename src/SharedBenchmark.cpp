@@ -0,0 +1,151 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "BenchmarkUtils.h"
+#include "SharedVector.h"
+#include "Vector.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+
+void writeAll(int fd, const void* data, std::size_t bytes)
+{
+    const char* p = static_cast<const char*>(data);
+    while(bytes > 0)
+    {
+        const ssize_t written = write(fd, p, bytes);
+        if(written <= 0) std::exit(1);
+        p += written;
+        bytes -= written;
+    }
+}
+
+void readAll(int fd, void* data, std::size_t bytes)
+{
+    char* p = static_cast<char*>(data);
+    while(bytes > 0)
+    {
+        const ssize_t got = read(fd, p, bytes);
+        if(got <= 0) std::exit(1);
+        p += got;
+        bytes -= got;
+    }
+}
+
+//The child receives every payload into a Vector and acknowledges it with one byte
+double pipeRoundTripUs(const aisdi::Vector<double>& payload, int rounds)
+{
+    int toChild[2], toParent[2];
+    if(pipe(toChild) != 0 || pipe(toParent) != 0) std::exit(1);
+    const pid_t child = fork();
+    if(child == 0)
+    {
+        aisdi::Vector<double> received;
+        for(int round = 0; round < rounds; ++round)
+        {
+            std::uint64_t size;
+            readAll(toChild[0], &size, sizeof(size));
+            received.resize(size);
+            readAll(toChild[0], received.data(), size * sizeof(double));
+            const char ack = 1;
+            writeAll(toParent[1], &ack, 1);
+        }
+        _exit(0);
+    }
+
+    const double ms = measureMs([&]
+    {
+        for(int round = 0; round < rounds; ++round)
+        {
+            const std::uint64_t size = payload.getSize();
+            writeAll(toChild[1], &size, sizeof(size));
+            writeAll(toChild[1], payload.data(), size * sizeof(double));
+            char ack;
+            readAll(toParent[0], &ack, 1);
+        }
+    });
+    waitpid(child, nullptr, 0);
+    close(toChild[0]);
+    close(toChild[1]);
+    close(toParent[0]);
+    close(toParent[1]);
+    return ms * 1000 / rounds;
+}
+
+//The child reads every publication in place and acknowledges it through a second segment.
+//Both segments are created before fork(), so the child inherits the writer of the second one.
+double sharedRoundTripUs(const aisdi::Vector<double>& payload, int rounds)
+{
+    using Shared = aisdi::SharedVector<double>;
+    const std::string dataName = "/aisdi_benchmark_data_" + std::to_string(getpid());
+    const std::string ackName = "/aisdi_benchmark_ack_" + std::to_string(getpid());
+    Shared data(dataName, Shared::OpenMode::Create, payload.getSize());
+    Shared ack(ackName, Shared::OpenMode::Create, 1);
+
+    const pid_t child = fork();
+    if(child == 0)
+    {
+        const Shared received(dataName, Shared::OpenMode::Open);
+        double last = 0;
+        std::uint64_t seen = 0;
+        for(int round = 0; round < rounds; ++round)
+        {
+            seen = received.waitForVersion(seen);
+            received.read([&last](const double* items, std::size_t size)
+            {
+                last = size ? items[size - 1] : 0;
+            });
+            ack.publish(&last, 1);
+        }
+        _exit(0);
+    }
+
+    const Shared acknowledged(ackName, Shared::OpenMode::Open);
+    const double ms = measureMs([&]
+    {
+        for(int round = 0; round < rounds; ++round)
+        {
+            data.publish(payload);
+            acknowledged.waitForVersion(round);
+        }
+    });
+    waitpid(child, nullptr, 0);
+    Shared::remove(dataName);
+    Shared::remove(ackName);
+    return ms * 1000 / rounds;
+}
+
+void perfomTest(std::size_t size, int rounds)
+{
+    aisdi::Vector<double> payload;
+    payload.resize(size);
+    for(std::size_t i = 0; i < size; ++i)
+        payload.data()[i] = i * 0.5;
+
+    std::cout << std::setw(10) << size << std::fixed << std::setprecision(1)
+              << std::setw(14) << pipeRoundTripUs(payload, rounds)
+              << std::setw(14) << sharedRoundTripUs(payload, rounds) << std::endl;
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const int rounds = argc > 1 ? std::atoi(argv[1]) : 200;
+
+    std::cout << "round trip of a Vector<double> to another process" << std::endl
+              << "  elements     pipe[us]    shared[us]" << std::endl;
+    for(std::size_t size = 16; size <= 4 * 1024 * 1024; size *= 16)
+        perfomTest(size, rounds);
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,319 @@
+#ifndef AISDI_LINEAR_SHAREDVECTOR_H
+#define AISDI_LINEAR_SHAREDVECTOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Vector.h"
+
+namespace aisdi
+{
+
+//Vector of trivially copyable elements published through a POSIX shared-memory segment.
+//One process creates the segment and publishes whole contents; any number of processes open
+//it by name and read it. Publication is guarded by a sequence lock: the writer makes the
+//sequence odd while it copies, readers retry whenever the sequence was odd or has changed
+//while they were reading, so readers never block the writer.
+//The segment holds no pointers, only a header with offsets, so every process may map it anywhere.
+//Creating a segment whose name exists unlinks the old segment instead of truncating it: readers
+//that still map it keep reading its last publication, and see the new one once they reopen the name.
+template <typename Type>
+class SharedVector
+{
+    static_assert(std::is_trivially_copyable<Type>::value, "SharedVector needs trivially copyable elements");
+
+public:
+    using size_type = std::size_t;
+    using value_type = Type;
+    using const_pointer = const Type*;
+
+    enum class OpenMode
+    {
+        Create, //Create the segment, unlinking one of the same name, and become its only writer
+        Open    //Open an existing segment for reading
+    };
+
+private:
+    struct Header
+    {
+        std::uint64_t magic;
+        std::uint64_t elementSize;
+        std::uint64_t payloadOffset; //Distance between the segment start and the first element
+        std::atomic<std::uint64_t> sequence; //Odd while the writer is publishing
+        std::atomic<std::uint64_t> size;
+        std::atomic<std::uint64_t> capacity;
+    };
+
+    static const std::uint64_t MAGIC = 0x3148534D49534941ULL; //"AISIMSH1"
+    static const size_type HEADER_SIZE = 64; //Keeps the elements cache-line aligned
+
+    static_assert(std::is_standard_layout<Header>::value && sizeof(Header) <= HEADER_SIZE, "Header has to fit in HEADER_SIZE");
+
+    std::string name;
+    int fd;
+    bool writer;
+    char* mapping;
+    size_type mappedBytes;
+    const double INCREASE_FACTOR = 0.5; //Factor by which the capacity will be increased when the segment grows
+
+    static void fail(const char* what)
+    {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    Header* header() const
+    {
+        return reinterpret_cast<Header*>(mapping);
+    }
+
+    const_pointer elements() const
+    {
+        return reinterpret_cast<const_pointer>(mapping + header()->payloadOffset);
+    }
+
+    size_type mappedCapacity() const
+    {
+        return (mappedBytes - HEADER_SIZE) / sizeof(Type);
+    }
+
+    void map(size_type bytes)
+    {
+        void* mapped = mmap(nullptr, bytes, writer ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+        if(mapped == MAP_FAILED) fail("mmap");
+        if(mapping) munmap(mapping, mappedBytes);
+        mapping = static_cast<char*>(mapped);
+        mappedBytes = bytes;
+    }
+
+    //Writer side: make the segment large enough for *newCapacity* elements
+    void grow(size_type newCapacity)
+    {
+        const size_type bytes = HEADER_SIZE + newCapacity * sizeof(Type);
+        if(ftruncate(fd, static_cast<off_t>(bytes)) != 0) fail("ftruncate");
+        map(bytes);
+        header()->capacity.store(newCapacity, std::memory_order_relaxed);
+    }
+
+    //Reader side: follow a segment grown by the writer
+    void followGrowth() const
+    {
+        const size_type capacity = header()->capacity.load(std::memory_order_relaxed);
+        if(capacity > mappedCapacity())
+            const_cast<SharedVector*>(this)->map(HEADER_SIZE + capacity * sizeof(Type));
+    }
+
+    void release()
+    {
+        if(mapping) munmap(mapping, mappedBytes);
+        mapping = nullptr;
+        if(fd >= 0) close(fd);
+        fd = -1;
+    }
+
+public:
+    SharedVector(const std::string& segmentName, OpenMode mode, size_type capacity = 0)
+            : name(segmentName), fd(-1), writer(mode == OpenMode::Create), mapping(nullptr), mappedBytes(0)
+    {
+        if(writer)
+        {
+            //Truncating a live segment would make its readers fault with SIGBUS
+            remove(name);
+            fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        }
+        else fd = shm_open(name.c_str(), O_RDONLY, 0);
+        if(fd < 0) fail("shm_open");
+
+        if(writer)
+        {
+            const size_type bytes = HEADER_SIZE + capacity * sizeof(Type);
+            if(ftruncate(fd, static_cast<off_t>(bytes)) != 0)
+            {
+                release();
+                fail("ftruncate");
+            }
+            try
+            {
+                map(bytes);
+            }
+            catch(...)
+            {
+                release();
+                throw;
+            }
+            Header* h = new (mapping) Header;
+            h->magic = MAGIC;
+            h->elementSize = sizeof(Type);
+            h->payloadOffset = HEADER_SIZE;
+            h->sequence.store(0, std::memory_order_relaxed);
+            h->size.store(0, std::memory_order_relaxed);
+            h->capacity.store(capacity, std::memory_order_release);
+            return;
+        }
+
+        struct stat info;
+        if(fstat(fd, &info) != 0)
+        {
+            release();
+            fail("fstat");
+        }
+        const size_type bytes = static_cast<size_type>(info.st_size);
+        if(bytes < HEADER_SIZE)
+        {
+            release();
+            throw std::runtime_error("Not a SharedVector segment: " + name);
+        }
+        try
+        {
+            map(bytes);
+        }
+        catch(...)
+        {
+            release();
+            throw;
+        }
+        if(header()->magic != MAGIC || header()->elementSize != sizeof(Type) || header()->payloadOffset != HEADER_SIZE)
+        {
+            release();
+            throw std::runtime_error("Not a SharedVector segment of this element type: " + name);
+        }
+    }
+
+    SharedVector(const SharedVector&) = delete;
+    SharedVector& operator=(const SharedVector&) = delete;
+
+    SharedVector(SharedVector&& other) : name(std::move(other.name)), fd(other.fd), writer(other.writer),
+                    mapping(other.mapping), mappedBytes(other.mappedBytes)
+    {
+        other.fd = -1;
+        other.mapping = nullptr;
+    }
+
+    //The segment outlives the object, remove() deletes its name
+    ~SharedVector()
+    {
+        release();
+    }
+
+    static void remove(const std::string& segmentName)
+    {
+        if(shm_unlink(segmentName.c_str()) != 0 && errno != ENOENT) fail("shm_unlink");
+    }
+
+    bool isWriter() const
+    {
+        return writer;
+    }
+
+    //Number of completed publications; a reader may wait for it to pass a value it has seen
+    std::uint64_t getVersion() const
+    {
+        return header()->sequence.load(std::memory_order_acquire) / 2;
+    }
+
+    //Size of the last publication, may be outdated as soon as it is returned
+    size_type getSize() const
+    {
+        return header()->size.load(std::memory_order_relaxed);
+    }
+
+    //Replace the contents with *count* elements copied from *items*
+    void publish(const_pointer items, size_type count)
+    {
+        if(!writer) throw std::logic_error("Vector is read-only");
+        Header* h = header();
+        const std::uint64_t sequence = h->sequence.load(std::memory_order_relaxed);
+        h->sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        if(count > mappedCapacity())
+        {
+            try
+            {
+                grow(std::max<size_type>(count, mappedCapacity() * (1 + INCREASE_FACTOR)));
+            }
+            catch(...)
+            {
+                //The old contents are untouched, so they are published again
+                h->sequence.store(sequence + 2, std::memory_order_release);
+                throw;
+            }
+            h = header();
+        }
+        if(count) std::memcpy(mapping + HEADER_SIZE, items, count * sizeof(Type));
+        h->size.store(count, std::memory_order_relaxed);
+
+        h->sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    void publish(const Vector<Type>& vector)
+    {
+        publish(vector.data(), vector.getSize());
+    }
+
+    //Call f(elements, size) on the published elements in place, without copying them.
+    //f is called again whenever the writer published in the meantime, so it must not keep
+    //anything it has read before returning; the version that was read is returned.
+    template <typename Function>
+    std::uint64_t read(Function f) const
+    {
+        const Header* h = header();
+        for(;;)
+        {
+            const std::uint64_t before = h->sequence.load(std::memory_order_acquire);
+            if(before % 2 == 0)
+            {
+                const size_type size = h->size.load(std::memory_order_relaxed);
+                if(size > mappedCapacity()) followGrowth();
+                h = header();
+                if(size <= mappedCapacity())
+                {
+                    f(elements(), size);
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if(h->sequence.load(std::memory_order_relaxed) == before) return before / 2;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    //Consistent copy of the last publication
+    Vector<Type> snapshot() const
+    {
+        Vector<Type> result;
+        read([&result](const_pointer items, size_type size)
+        {
+            result.resize(size);
+            if(size) std::memcpy(result.data(), items, size * sizeof(Type));
+        });
+        return result;
+    }
+
+    //Spin (yielding the processor) until a version newer than *seen* is published
+    std::uint64_t waitForVersion(std::uint64_t seen) const
+    {
+        std::uint64_t version;
+        while((version = getVersion()) <= seen)
+            std::this_thread::yield();
+        return version;
+    }
+};
+
+}
+
+#endif // AISDI_LINEAR_SHAREDVECTOR_H
@@ -0,0 +1,70 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "BenchmarkUtils.h"
+#include "SimdKernels.h"
+
+namespace
+{
+
+//Runs *f* *repeats* times and returns the throughput in GB/s for *bytes* read per run
+template <typename Function>
+double measureGBs(std::size_t bytes, int repeats, Function f)
+{
+    const double seconds = aisdi::benchmark::measureMs(repeats, f) / 1000;
+    return bytes / seconds / 1e9;
+}
+
+template <typename T>
+void perfomTest(const std::string& typeName, std::size_t size, int repeats)
+{
+    aisdi::Vector<T> values;
+    values.resize(size);
+    for(std::size_t i = 0; i < size; ++i)
+        values.data()[i] = static_cast<T>(i % 1000);
+
+    const std::size_t bytes = size * sizeof(T);
+    volatile std::size_t sink = 0; //Every kernel result is stored here, so that no kernel call is optimized away
+    std::size_t checked = 0;
+
+    //Element-by-element loop through checked iterators, as done before the kernels existed
+    const double iteratorGBs = measureGBs(bytes, repeats, [&]
+    {
+        std::size_t found = 0;
+        for(auto it = values.cbegin(); it != values.cend(); ++it)
+            if(*it == T(1000)) ++found;
+        checked = found;
+    });
+    const double countGBs = measureGBs(bytes, repeats, [&]{ sink = aisdi::simd::count(values, T(1000)); });
+    const double findGBs = measureGBs(bytes, repeats, [&]{ sink = aisdi::simd::contains(values, T(1000)); });
+    const double minGBs = measureGBs(bytes, repeats, [&]{ sink = static_cast<std::size_t>(aisdi::simd::min(values)); });
+    const double maxGBs = measureGBs(bytes, repeats, [&]{ sink = static_cast<std::size_t>(aisdi::simd::max(values)); });
+    const double sumGBs = measureGBs(bytes, repeats, [&]{ sink = static_cast<std::size_t>(aisdi::simd::sum(values)); });
+
+    std::cout << std::setw(8) << typeName << std::fixed << std::setprecision(2)
+              << std::setw(12) << iteratorGBs << std::setw(10) << countGBs << std::setw(10) << findGBs
+              << std::setw(10) << minGBs << std::setw(10) << maxGBs << std::setw(10) << sumGBs
+              << "   (" << checked << " matches)" << std::endl;
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const std::size_t size = argc > 1 ? std::atoll(argv[1]) : 10000000;
+    const int repeats = argc > 2 ? std::atoi(argv[2]) : 20;
+
+    std::cout << "AVX2 " << (aisdi::simd::detail::hasAvx2() ? "available" : "not available")
+              << ", " << size << " elements, throughput in GB/s" << std::endl;
+    std::cout << "    type  iterator    count     find      min       max       sum" << std::endl;
+    perfomTest<std::int32_t>("int32_t", size, repeats);
+    perfomTest<float>("float", size, repeats);
+    perfomTest<double>("double", size, repeats);
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
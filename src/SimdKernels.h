@@ -0,0 +1,494 @@
+#ifndef AISDI_LINEAR_SIMDKERNELS_H
+#define AISDI_LINEAR_SIMDKERNELS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include "Vector.h"
+
+//Kernels are written with GCC/Clang vector extensions. The same kernel is instantiated
+//for 16-byte registers (SSE2, always present on x86-64) and inside functions compiled
+//for AVX2 with 32-byte registers; the AVX2 variant is chosen at run time.
+#if defined(__GNUC__)
+#  define AISDI_SIMD_VECTOR_EXTENSIONS 1
+#  if defined(__x86_64__) || defined(__i386__)
+#    define AISDI_SIMD_X86 1
+#    define AISDI_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#  endif
+#  define AISDI_SIMD_INLINE __attribute__((always_inline)) inline
+#endif
+
+namespace aisdi
+{
+namespace simd
+{
+namespace detail
+{
+
+//Sums of 32-bit integers are accumulated in 64 bits
+template <typename Type>
+struct SumType
+{
+    using type = Type;
+};
+
+template <>
+struct SumType<std::int32_t>
+{
+    using type = std::int64_t;
+};
+
+template <typename Type, typename Result>
+Result scalarSum(const Type* data, std::size_t size, Result acc)
+{
+    for(std::size_t i = 0; i < size; ++i)
+        acc += data[i];
+    return acc;
+}
+
+template <typename Type>
+std::size_t scalarFind(const Type* data, std::size_t size, const Type& value)
+{
+    for(std::size_t i = 0; i < size; ++i)
+        if(data[i] == value) return i;
+    return size;
+}
+
+template <typename Type>
+std::size_t scalarCount(const Type* data, std::size_t size, const Type& value)
+{
+    std::size_t found = 0;
+    for(std::size_t i = 0; i < size; ++i)
+        if(data[i] == value) ++found;
+    return found;
+}
+
+template <typename Type>
+Type scalarMin(const Type* data, std::size_t size)
+{
+    Type result = data[0];
+    for(std::size_t i = 1; i < size; ++i)
+        if(data[i] < result) result = data[i];
+    return result;
+}
+
+template <typename Type>
+Type scalarMax(const Type* data, std::size_t size)
+{
+    Type result = data[0];
+    for(std::size_t i = 1; i < size; ++i)
+        if(result < data[i]) result = data[i];
+    return result;
+}
+
+//Generic fallback: plain loops over the contiguous storage
+template <typename Type>
+struct Kernels
+{
+    using sum_type = typename SumType<Type>::type;
+
+    static std::size_t find(const Type* data, std::size_t size, const Type& value)
+    {
+        return scalarFind(data, size, value);
+    }
+
+    static std::size_t count(const Type* data, std::size_t size, const Type& value)
+    {
+        return scalarCount(data, size, value);
+    }
+
+    static Type min(const Type* data, std::size_t size)
+    {
+        return scalarMin(data, size);
+    }
+
+    static Type max(const Type* data, std::size_t size)
+    {
+        return scalarMax(data, size);
+    }
+
+    static sum_type sum(const Type* data, std::size_t size)
+    {
+        return scalarSum(data, size, sum_type());
+    }
+};
+
+//Whether the CPU runs the AVX2 kernels; always false where they are not compiled in
+#ifdef AISDI_SIMD_X86
+inline bool hasAvx2()
+{
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+#else
+inline bool hasAvx2()
+{
+    return false;
+}
+#endif
+
+#ifdef AISDI_SIMD_VECTOR_EXTENSIONS
+
+//Register types: *type* holds the elements and *mask* is the result of a lane-wise comparison.
+//Integer registers can also be viewed as *pairs* of 32-bit values packed in 64-bit lanes.
+template <typename Type, std::size_t Bytes>
+struct Register;
+
+template <>
+struct Register<std::int32_t, 16>
+{
+    typedef std::int32_t type __attribute__((vector_size(16)));
+    typedef std::int32_t mask __attribute__((vector_size(16)));
+    typedef std::uint64_t pairs __attribute__((vector_size(16)));
+};
+
+template <>
+struct Register<std::int32_t, 32>
+{
+    typedef std::int32_t type __attribute__((vector_size(32)));
+    typedef std::int32_t mask __attribute__((vector_size(32)));
+    typedef std::uint64_t pairs __attribute__((vector_size(32)));
+};
+
+template <>
+struct Register<float, 16>
+{
+    typedef float type __attribute__((vector_size(16)));
+    typedef std::int32_t mask __attribute__((vector_size(16)));
+};
+
+template <>
+struct Register<float, 32>
+{
+    typedef float type __attribute__((vector_size(32)));
+    typedef std::int32_t mask __attribute__((vector_size(32)));
+};
+
+template <>
+struct Register<double, 16>
+{
+    typedef double type __attribute__((vector_size(16)));
+    typedef std::int64_t mask __attribute__((vector_size(16)));
+};
+
+template <>
+struct Register<double, 32>
+{
+    typedef double type __attribute__((vector_size(32)));
+    typedef std::int64_t mask __attribute__((vector_size(32)));
+};
+
+//Kernels below are always inlined, so they are compiled for the instruction set of the caller.
+//Registers are passed by reference only: returning a 32-byte vector from a function compiled
+//without AVX would change the ABI.
+template <typename Block, typename Type>
+AISDI_SIMD_INLINE void load(Block& block, const Type* data)
+{
+    std::memcpy(&block, data, sizeof(Block));
+}
+
+template <typename Block, typename Type>
+AISDI_SIMD_INLINE void broadcast(Block& block, Type value)
+{
+    for(std::size_t lane = 0; lane < sizeof(Block) / sizeof(Type); ++lane)
+        block[lane] = value;
+}
+
+template <typename Type, std::size_t Bytes>
+AISDI_SIMD_INLINE std::size_t findKernel(const Type* data, std::size_t size, Type value)
+{
+    using Block = typename Register<Type, Bytes>::type;
+    using Mask = typename Register<Type, Bytes>::mask;
+    const std::size_t lanes = Bytes / sizeof(Type);
+    const std::size_t step = 4 * lanes;
+    Block needle, b0, b1, b2, b3;
+    broadcast(needle, value);
+
+    std::size_t i = 0;
+    for(; i + step <= size; i += step)
+    {
+        //Test four registers at once and look for the exact position only after a hit
+        load(b0, data + i);
+        load(b1, data + i + lanes);
+        load(b2, data + i + 2 * lanes);
+        load(b3, data + i + 3 * lanes);
+        Mask hits = (b0 == needle) | (b1 == needle) | (b2 == needle) | (b3 == needle);
+        std::uint64_t any[Bytes / 8];
+        std::memcpy(any, &hits, Bytes);
+        std::uint64_t merged = 0;
+        for(std::size_t word = 0; word < Bytes / 8; ++word)
+            merged |= any[word];
+        if(merged) return i + scalarFind(data + i, step, value);
+    }
+    return i + scalarFind(data + i, size - i, value);
+}
+
+//Blocks after which the lane counters of countKernel are added up, below the 32-bit lane limit
+const std::size_t COUNT_FLUSH_BLOCKS = 0x7FFFFFFF;
+
+template <typename Type, std::size_t Bytes>
+AISDI_SIMD_INLINE std::size_t countKernel(const Type* data, std::size_t size, Type value,
+                                          std::size_t flushBlocks = COUNT_FLUSH_BLOCKS)
+{
+    using Block = typename Register<Type, Bytes>::type;
+    using Mask = typename Register<Type, Bytes>::mask;
+    const std::size_t lanes = Bytes / sizeof(Type);
+    Block needle, block;
+    broadcast(needle, value);
+
+    //Matching lanes compare to -1, so subtracting the mask counts them. A lane gains at most one
+    //per block, so the lanes are added up every *flushBlocks* blocks, before they can overflow.
+    std::size_t found = 0, i = 0;
+    while(i + lanes <= size)
+    {
+        Mask acc = {};
+        const std::size_t last = i + std::min((size - i) / lanes, flushBlocks) * lanes;
+        for(; i < last; i += lanes)
+        {
+            load(block, data + i);
+            acc -= block == needle;
+        }
+        for(std::size_t lane = 0; lane < lanes; ++lane)
+            found += static_cast<std::size_t>(acc[lane]);
+    }
+    return found + scalarCount(data + i, size - i, value);
+}
+
+template <typename Type, std::size_t Bytes>
+AISDI_SIMD_INLINE Type minKernel(const Type* data, std::size_t size)
+{
+    const std::size_t lanes = Bytes / sizeof(Type);
+    if(size < lanes) return scalarMin(data, size);
+
+    typename Register<Type, Bytes>::type acc, block;
+    load(acc, data);
+    std::size_t i = lanes;
+    for(; i + lanes <= size; i += lanes)
+    {
+        load(block, data + i);
+        acc = block < acc ? block : acc;
+    }
+
+    Type result = acc[0];
+    for(std::size_t lane = 1; lane < lanes; ++lane)
+        if(acc[lane] < result) result = acc[lane];
+    for(; i < size; ++i)
+        if(data[i] < result) result = data[i];
+    return result;
+}
+
+template <typename Type, std::size_t Bytes>
+AISDI_SIMD_INLINE Type maxKernel(const Type* data, std::size_t size)
+{
+    const std::size_t lanes = Bytes / sizeof(Type);
+    if(size < lanes) return scalarMax(data, size);
+
+    typename Register<Type, Bytes>::type acc, block;
+    load(acc, data);
+    std::size_t i = lanes;
+    for(; i + lanes <= size; i += lanes)
+    {
+        load(block, data + i);
+        acc = acc < block ? block : acc;
+    }
+
+    Type result = acc[0];
+    for(std::size_t lane = 1; lane < lanes; ++lane)
+        if(result < acc[lane]) result = acc[lane];
+    for(; i < size; ++i)
+        if(result < data[i]) result = data[i];
+    return result;
+}
+
+template <std::size_t Bytes, typename Type>
+AISDI_SIMD_INLINE Type sumKernel(const Type* data, std::size_t size)
+{
+    const std::size_t lanes = Bytes / sizeof(Type);
+
+    typename Register<Type, Bytes>::type acc = {}, block;
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes)
+    {
+        load(block, data + i);
+        acc += block;
+    }
+
+    Type result = 0;
+    for(std::size_t lane = 0; lane < lanes; ++lane)
+        result += acc[lane];
+    return scalarSum(data + i, size - i, result);
+}
+
+//32-bit integers are summed in 64-bit lanes without sign extension (which SSE2/AVX2 lack):
+//flipping the sign bit turns every value x into x + 2^31 >= 0, then the low and high halves
+//of each 64-bit lane are added separately and the bias is subtracted at the end
+template <std::size_t Bytes>
+AISDI_SIMD_INLINE std::int64_t sumKernel(const std::int32_t* data, std::size_t size)
+{
+    using Pairs = typename Register<std::int32_t, Bytes>::pairs;
+    const std::size_t lanes = Bytes / sizeof(std::int32_t);
+    const std::uint64_t flip = 0x8000000080000000ULL, low = 0xFFFFFFFFULL;
+
+    Pairs flipMask, lowMask, block, acc = {};
+    broadcast(flipMask, flip);
+    broadcast(lowMask, low);
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes)
+    {
+        load(block, data + i);
+        block ^= flipMask;
+        acc += (block & lowMask) + (block >> 32);
+    }
+
+    std::uint64_t biased = 0;
+    for(std::size_t lane = 0; lane < lanes / 2; ++lane)
+        biased += acc[lane];
+    const std::int64_t result = static_cast<std::int64_t>(biased - (static_cast<std::uint64_t>(i) << 31));
+    return scalarSum(data + i, size - i, result);
+}
+
+#ifdef AISDI_SIMD_X86
+template <typename Type>
+AISDI_SIMD_TARGET_AVX2 std::size_t findAvx2(const Type* data, std::size_t size, Type value)
+{
+    return findKernel<Type, 32>(data, size, value);
+}
+
+template <typename Type>
+AISDI_SIMD_TARGET_AVX2 std::size_t countAvx2(const Type* data, std::size_t size, Type value)
+{
+    return countKernel<Type, 32>(data, size, value);
+}
+
+template <typename Type>
+AISDI_SIMD_TARGET_AVX2 Type minAvx2(const Type* data, std::size_t size)
+{
+    return minKernel<Type, 32>(data, size);
+}
+
+template <typename Type>
+AISDI_SIMD_TARGET_AVX2 Type maxAvx2(const Type* data, std::size_t size)
+{
+    return maxKernel<Type, 32>(data, size);
+}
+
+template <typename Type>
+AISDI_SIMD_TARGET_AVX2 typename SumType<Type>::type sumAvx2(const Type* data, std::size_t size)
+{
+    return sumKernel<32>(data, size);
+}
+#endif
+
+//Kernels for the arithmetic types with SIMD support, dispatching on the CPU features
+template <typename Type>
+struct VectorizedKernels
+{
+    using sum_type = typename SumType<Type>::type;
+
+    static std::size_t find(const Type* data, std::size_t size, const Type& value)
+    {
+#ifdef AISDI_SIMD_X86
+        if(hasAvx2()) return findAvx2(data, size, value);
+#endif
+        return findKernel<Type, 16>(data, size, value);
+    }
+
+    static std::size_t count(const Type* data, std::size_t size, const Type& value)
+    {
+#ifdef AISDI_SIMD_X86
+        if(hasAvx2()) return countAvx2(data, size, value);
+#endif
+        return countKernel<Type, 16>(data, size, value);
+    }
+
+    static Type min(const Type* data, std::size_t size)
+    {
+#ifdef AISDI_SIMD_X86
+        if(hasAvx2()) return minAvx2(data, size);
+#endif
+        return minKernel<Type, 16>(data, size);
+    }
+
+    static Type max(const Type* data, std::size_t size)
+    {
+#ifdef AISDI_SIMD_X86
+        if(hasAvx2()) return maxAvx2(data, size);
+#endif
+        return maxKernel<Type, 16>(data, size);
+    }
+
+    static sum_type sum(const Type* data, std::size_t size)
+    {
+#ifdef AISDI_SIMD_X86
+        if(hasAvx2()) return sumAvx2(data, size);
+#endif
+        return sumKernel<16>(data, size);
+    }
+};
+
+template <>
+struct Kernels<std::int32_t> : VectorizedKernels<std::int32_t>
+{};
+
+template <>
+struct Kernels<float> : VectorizedKernels<float>
+{};
+
+template <>
+struct Kernels<double> : VectorizedKernels<double>
+{};
+
+#endif // AISDI_SIMD_VECTOR_EXTENSIONS
+
+}
+
+//Position of the first element equal to *value* or end() if there is none
+template <typename Type>
+typename Vector<Type>::const_iterator find(const Vector<Type>& vector, const Type& value)
+{
+    return vector.begin() + detail::Kernels<Type>::find(vector.data(), vector.getSize(), value);
+}
+
+template <typename Type>
+bool contains(const Vector<Type>& vector, const Type& value)
+{
+    return detail::Kernels<Type>::find(vector.data(), vector.getSize(), value) != vector.getSize();
+}
+
+template <typename Type>
+std::size_t count(const Vector<Type>& vector, const Type& value)
+{
+    return detail::Kernels<Type>::count(vector.data(), vector.getSize(), value);
+}
+
+//Smallest element; the result is unspecified if a floating point vector holds NaNs
+template <typename Type>
+Type min(const Vector<Type>& vector)
+{
+    if(vector.isEmpty()) throw std::logic_error("Vector is empty");
+    return detail::Kernels<Type>::min(vector.data(), vector.getSize());
+}
+
+//Largest element; the result is unspecified if a floating point vector holds NaNs
+template <typename Type>
+Type max(const Vector<Type>& vector)
+{
+    if(vector.isEmpty()) throw std::logic_error("Vector is empty");
+    return detail::Kernels<Type>::max(vector.data(), vector.getSize());
+}
+
+//Sum of all elements; 32-bit integers are summed in 64 bits. Floating point sums are computed
+//in several lanes at once, so rounding may differ slightly from a left-to-right loop.
+template <typename Type>
+typename detail::SumType<Type>::type sum(const Vector<Type>& vector)
+{
+    return detail::Kernels<Type>::sum(vector.data(), vector.getSize());
+}
+
+}
+}
+
+#endif // AISDI_LINEAR_SIMDKERNELS_H
@@ -0,0 +1,225 @@
+#ifndef AISDI_LINEAR_SLOTMAP_H
+#define AISDI_LINEAR_SLOTMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include "Vector.h"
+
+namespace aisdi
+{
+
+//Container handing out stable handles instead of positions. Values are kept densely packed
+//in a Vector for fast iteration; a slot table maps every handle to the current position of
+//its value. Erasing moves the last value into the hole and bumps the slot's generation, so
+//insert, erase and lookup are O(1) and a handle to an erased value is detected instead of
+//silently reaching whatever took its place.
+template <typename Type>
+class SlotMap
+{
+public:
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type*;
+    using reference = Type&;
+    using const_pointer = const Type*;
+    using const_reference = const Type&;
+    using iterator = typename Vector<Type>::iterator;
+    using const_iterator = typename Vector<Type>::const_iterator;
+
+    struct Handle
+    {
+        std::uint32_t index;
+        std::uint32_t generation;
+
+        Handle() : index(NONE), generation(0)
+        {}
+
+        Handle(std::uint32_t i, std::uint32_t g) : index(i), generation(g)
+        {}
+
+        bool operator==(const Handle& other) const
+        {
+            return index == other.index && generation == other.generation;
+        }
+
+        bool operator!=(const Handle& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    static const std::uint32_t NONE = UINT32_MAX; //Slot index of a null handle, end of the free list
+
+private:
+    struct Slot
+    {
+        std::uint32_t generation; //Incremented whenever the value in the slot is erased
+        std::uint32_t position; //Index in *values* when occupied, next free slot otherwise
+    };
+
+    Vector<value_type> values;
+    Vector<std::uint32_t> owners; //Slot of every value in *values*
+    Vector<Slot> slots;
+    std::uint32_t freeSlots; //Head of the list of unused slots
+
+    const Slot* slotFor(const Handle& handle) const
+    {
+        if(handle.index >= slots.getSize()) return nullptr;
+        const Slot* slot = slots.data() + handle.index;
+        if(slot->generation != handle.generation) return nullptr;
+        return slot;
+    }
+
+public:
+    SlotMap() : freeSlots(NONE)
+    {}
+
+    bool isEmpty() const
+    {
+        return values.isEmpty();
+    }
+
+    size_type getSize() const
+    {
+        return values.getSize();
+    }
+
+    //Make room for *count* values without reallocating
+    void reserve(size_type count)
+    {
+        values.reserve(count);
+        owners.reserve(count);
+        slots.reserve(count);
+    }
+
+    Handle insert(const Type& item)
+    {
+        std::uint32_t index = freeSlots;
+        if(index == NONE)
+        {
+            if(slots.getSize() == NONE) throw std::length_error("SlotMap is full");
+            index = static_cast<std::uint32_t>(slots.getSize());
+            slots.append(Slot{ 0, 0 });
+        }
+        else freeSlots = slots.data()[index].position;
+
+        Slot& slot = slots.data()[index];
+        slot.position = static_cast<std::uint32_t>(values.getSize());
+        values.append(item);
+        owners.append(index);
+        return Handle(index, slot.generation);
+    }
+
+    //True when *handle* refers to a value that has not been erased
+    bool contains(const Handle& handle) const
+    {
+        return slotFor(handle) != nullptr;
+    }
+
+    //The value behind *handle*, or nullptr when it was erased
+    pointer find(const Handle& handle)
+    {
+        const Slot* slot = slotFor(handle);
+        return slot ? values.data() + slot->position : nullptr;
+    }
+
+    const_pointer find(const Handle& handle) const
+    {
+        const Slot* slot = slotFor(handle);
+        return slot ? values.data() + slot->position : nullptr;
+    }
+
+    reference operator[](const Handle& handle)
+    {
+        pointer item = find(handle);
+        if(!item) throw std::out_of_range("Invalid handle");
+        return *item;
+    }
+
+    const_reference operator[](const Handle& handle) const
+    {
+        const_pointer item = find(handle);
+        if(!item) throw std::out_of_range("Invalid handle");
+        return *item;
+    }
+
+    //Remove the value behind *handle*; the last value takes its place in the dense array
+    void erase(const Handle& handle)
+    {
+        const Slot* found = slotFor(handle);
+        if(!found) throw std::out_of_range("Invalid handle");
+        const std::uint32_t position = found->position;
+        const std::uint32_t last = static_cast<std::uint32_t>(values.getSize() - 1);
+        if(position != last)
+        {
+            values.data()[position] = values.data()[last];
+            owners.data()[position] = owners.data()[last];
+            slots.data()[owners.data()[position]].position = position;
+        }
+        values.popLast();
+        owners.popLast();
+
+        Slot& slot = slots.data()[handle.index];
+        ++slot.generation;
+        slot.position = freeSlots;
+        freeSlots = handle.index;
+    }
+
+    //Handle of the value at *position* of the dense array, e.g. while iterating
+    Handle handleAt(size_type position) const
+    {
+        if(position >= values.getSize()) throw std::out_of_range("Index out of range");
+        const std::uint32_t index = owners.data()[position];
+        return Handle(index, slots.data()[index].generation);
+    }
+
+    //Densely packed values; their order changes when values are erased
+    pointer data()
+    {
+        return values.data();
+    }
+
+    const_pointer data() const
+    {
+        return values.data();
+    }
+
+    iterator begin()
+    {
+        return values.begin();
+    }
+
+    iterator end()
+    {
+        return values.end();
+    }
+
+    const_iterator cbegin() const
+    {
+        return values.cbegin();
+    }
+
+    const_iterator cend() const
+    {
+        return values.cend();
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+};
+
+template <typename Type>
+const std::uint32_t SlotMap<Type>::NONE;
+
+}
+
+#endif // AISDI_LINEAR_SLOTMAP_H
@@ -0,0 +1,93 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "BenchmarkUtils.h"
+#include "SimdKernels.h"
+#include "SoaVector.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+
+//Typical record where scans touch only one or two fields
+struct Particle
+{
+    double x, y, z;
+    double vx, vy, vz;
+    float mass;
+    std::int32_t id;
+};
+
+using Particles = aisdi::SoaVector<double, double, double, double, double, double, float, std::int32_t>;
+
+void perfomTest(std::size_t size, int repeats)
+{
+    aisdi::Vector<Particle> aos;
+    aos.resize(size);
+    Particles soa;
+    soa.reserve(size);
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        const double v = static_cast<double>(i % 1000);
+        aos.data()[i] = Particle{ v, v, v, v, v, v, 1.0f, static_cast<std::int32_t>(i) };
+        soa.append(v, v, v, v, v, v, 1.0f, static_cast<std::int32_t>(i));
+    }
+
+    volatile double sink = 0;
+    const double aosX = measureMs(repeats, [&]
+    {
+        double acc = 0;
+        const Particle* p = aos.data();
+        for(std::size_t i = 0; i < size; ++i)
+            acc += p[i].x;
+        sink = acc;
+    });
+    const double soaX = measureMs(repeats, [&]
+    {
+        double acc = 0;
+        for(double x : soa.columnSpan<0>())
+            acc += x;
+        sink = acc;
+    });
+    const double soaXSimd = measureMs(repeats, [&]{ sink = aisdi::simd::sum(soa.column<0>()); });
+    const double aosXV = measureMs(repeats, [&]
+    {
+        double acc = 0;
+        const Particle* p = aos.data();
+        for(std::size_t i = 0; i < size; ++i)
+            acc += p[i].x * p[i].vx;
+        sink = acc;
+    });
+    const double soaXV = measureMs(repeats, [&]
+    {
+        double acc = 0;
+        const double* x = soa.columnSpan<0>().data();
+        const double* vx = soa.columnSpan<3>().data();
+        for(std::size_t i = 0; i < size; ++i)
+            acc += x[i] * vx[i];
+        sink = acc;
+    });
+
+    std::cout << size << " records of " << sizeof(Particle) << " bytes, times in ms" << std::endl;
+    std::cout << std::fixed << std::setprecision(3)
+              << "sum of x:       Vector<Struct> " << aosX << ", SoaVector " << soaX
+              << ", SoaVector + SIMD " << soaXSimd << std::endl
+              << "sum of x * vx:  Vector<Struct> " << aosXV << ", SoaVector " << soaXV << std::endl;
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const std::size_t size = argc > 1 ? std::atoll(argv[1]) : 10000000;
+    const int repeats = argc > 2 ? std::atoi(argv[2]) : 10;
+
+    perfomTest(size, repeats);
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
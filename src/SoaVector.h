@@ -0,0 +1,442 @@
+#ifndef AISDI_LINEAR_SOAVECTOR_H
+#define AISDI_LINEAR_SOAVECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+
+#include "Span.h"
+#include "Vector.h"
+
+namespace aisdi
+{
+
+//Structure-of-arrays vector: element i is the tuple of i-th items of the columns, and every
+//field lives in its own Vector. Scans over one field read only that field's memory.
+template <typename... Types>
+class SoaVector
+{
+public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = std::tuple<Types...>;
+
+    template <size_type Column>
+    using column_type = typename std::tuple_element<Column, value_type>::type;
+
+    class Reference;
+    class ConstReference;
+    class ConstIterator;
+    class Iterator;
+    using reference = Reference;
+    using const_reference = ConstReference;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+    static const size_type COLUMNS = sizeof...(Types);
+
+private:
+    std::tuple<Vector<Types>...> columns;
+    size_type size;
+
+    //Call f(column, index) for every column in order. Helper functors below stand in for
+    //generic lambdas, which C++11 does not have.
+    template <size_type Column = 0, typename Function>
+    typename std::enable_if<Column == COLUMNS>::type forEachColumn(Function&)
+    {}
+
+    template <size_type Column = 0, typename Function>
+    typename std::enable_if<(Column < COLUMNS)>::type forEachColumn(Function& f)
+    {
+        f(std::get<Column>(columns), std::integral_constant<size_type, Column>());
+        forEachColumn<Column + 1>(f);
+    }
+
+    struct InsertValue
+    {
+        size_type index;
+        const value_type& value;
+
+        template <typename Column, size_type I>
+        void operator()(Column& column, std::integral_constant<size_type, I>) const
+        {
+            column.insert(column.begin() + index, std::get<I>(value));
+        }
+    };
+
+    struct EraseRange
+    {
+        size_type first, last;
+
+        template <typename Column, size_type I>
+        void operator()(Column& column, std::integral_constant<size_type, I>) const
+        {
+            column.erase(column.begin() + first, column.begin() + last);
+        }
+    };
+
+    struct Reserve
+    {
+        size_type capacity;
+
+        template <typename Column, size_type I>
+        void operator()(Column& column, std::integral_constant<size_type, I>) const
+        {
+            column.reserve(capacity);
+        }
+    };
+
+    struct Assign
+    {
+        size_type index;
+        const value_type& value;
+
+        template <typename Column, size_type I>
+        void operator()(Column& column, std::integral_constant<size_type, I>) const
+        {
+            column.data()[index] = std::get<I>(value);
+        }
+    };
+
+    template <size_type... Columns>
+    struct Indices
+    {};
+
+    template <size_type N, size_type... Columns>
+    struct MakeIndices : MakeIndices<N - 1, N - 1, Columns...>
+    {};
+
+    template <size_type... Columns>
+    struct MakeIndices<0, Columns...>
+    {
+        using type = Indices<Columns...>;
+    };
+
+    template <size_type... Columns>
+    value_type load(size_type index, Indices<Columns...>) const
+    {
+        return value_type(std::get<Columns>(columns).data()[index]...);
+    }
+
+public:
+    SoaVector() : size(0)
+    {}
+
+    SoaVector(std::initializer_list<value_type> l) : SoaVector()
+    {
+        reserve(l.size());
+        for(const value_type& item : l)
+            append(item);
+    }
+
+    bool isEmpty() const
+    {
+        return size == 0;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    void reserve(size_type capacity)
+    {
+        Reserve f = { capacity };
+        forEachColumn(f);
+    }
+
+    void append(const value_type& item)
+    {
+        insert(end(), item);
+    }
+
+    void append(const Types&... fields)
+    {
+        append(value_type(fields...));
+    }
+
+    void prepend(const value_type& item)
+    {
+        insert(begin(), item);
+    }
+
+    void insert(const const_iterator& insertPosition, const value_type& item)
+    {
+        InsertValue f = { insertPosition.index, item };
+        forEachColumn(f);
+        ++size;
+    }
+
+    value_type popLast()
+    {
+        if(isEmpty()) throw std::logic_error("Vector is empty");
+        value_type item = *(end() - 1);
+        erase(end() - 1);
+        return item;
+    }
+
+    void erase(const const_iterator& possition)
+    {
+        erase(possition, possition + 1);
+    }
+
+    void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded)
+    {
+        if(isEmpty()) throw std::out_of_range("Vector is empty");
+        if(lastExcluded.index < firstIncluded.index || lastExcluded.index > size)
+            throw std::out_of_range("firstIncluded should be before lastExcluded");
+        if(firstIncluded.index == lastExcluded.index) return;
+        EraseRange f = { firstIncluded.index, lastExcluded.index };
+        forEachColumn(f);
+        size -= lastExcluded.index - firstIncluded.index;
+    }
+
+    //Whole column as a Vector, e.g. for the SIMD kernels or vector expressions
+    template <size_type Column>
+    const Vector<column_type<Column>>& column() const
+    {
+        return std::get<Column>(columns);
+    }
+
+    template <size_type Column>
+    Span<column_type<Column>> columnSpan()
+    {
+        return Span<column_type<Column>>(std::get<Column>(columns).data(), size);
+    }
+
+    template <size_type Column>
+    Span<const column_type<Column>> columnSpan() const
+    {
+        return Span<const column_type<Column>>(std::get<Column>(columns).data(), size);
+    }
+
+    reference operator[](size_type index)
+    {
+        return reference(this, index);
+    }
+
+    const_reference operator[](size_type index) const
+    {
+        return const_reference(this, index);
+    }
+
+    iterator begin()
+    {
+        return iterator(const_iterator(this, 0));
+    }
+
+    iterator end()
+    {
+        return iterator(const_iterator(this, size));
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(this, size);
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+};
+
+//Proxy standing for one row: fields are reached through get<Column>() and the whole row
+//converts to and from value_type
+template <typename... Types>
+class SoaVector<Types...>::ConstReference
+{
+protected:
+    const SoaVector* parent;
+    size_type index;
+
+public:
+    ConstReference(const SoaVector* p, size_type i) : parent(p), index(i)
+    {}
+
+    template <size_type Column>
+    const column_type<Column>& get() const
+    {
+        return std::get<Column>(parent->columns).data()[index];
+    }
+
+    operator value_type() const
+    {
+        return parent->load(index, typename MakeIndices<COLUMNS>::type());
+    }
+};
+
+template <typename... Types>
+class SoaVector<Types...>::Reference : public SoaVector<Types...>::ConstReference
+{
+public:
+    Reference(SoaVector* p, size_type i) : ConstReference(p, i)
+    {}
+
+    template <size_type Column>
+    column_type<Column>& get() const
+    {
+        return const_cast<column_type<Column>&>(ConstReference::template get<Column>());
+    }
+
+    const Reference& operator=(const value_type& item) const
+    {
+        Assign f = { this->index, item };
+        const_cast<SoaVector*>(this->parent)->forEachColumn(f);
+        return *this;
+    }
+
+    const Reference& operator=(const Reference& other) const
+    {
+        return *this = static_cast<value_type>(other);
+    }
+};
+
+template <typename... Types>
+class SoaVector<Types...>::ConstIterator
+{
+public:
+    friend class SoaVector<Types...>;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename SoaVector::value_type;
+    using difference_type = typename SoaVector::difference_type;
+    using pointer = void;
+    using reference = typename SoaVector::const_reference;
+
+protected:
+    const SoaVector* parent;
+    size_type index;
+
+public:
+    explicit ConstIterator() : parent(nullptr), index(0)
+    {}
+
+    ConstIterator(const SoaVector* p, size_type i) : parent(p), index(i)
+    {}
+
+    reference operator*() const
+    {
+        if(index >= parent->size) throw std::out_of_range("Iterator points at empty space after the last element");
+        return reference(parent, index);
+    }
+
+    ConstIterator& operator++()
+    {
+        if(index >= parent->size) throw std::out_of_range("Cannot increment iterator");
+        ++index;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    ConstIterator& operator--()
+    {
+        if(index == 0) throw std::out_of_range("Cannot decrement iterator");
+        --index;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        return ConstIterator(parent, index + d);
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        return ConstIterator(parent, index - d);
+    }
+
+    bool operator==(const ConstIterator& other) const
+    {
+        return parent == other.parent && index == other.index;
+    }
+
+    bool operator!=(const ConstIterator& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+template <typename... Types>
+class SoaVector<Types...>::Iterator : public SoaVector<Types...>::ConstIterator
+{
+public:
+    using reference = typename SoaVector::reference;
+
+    explicit Iterator()
+    {}
+
+    Iterator(const ConstIterator& other) : ConstIterator(other)
+    {}
+
+    Iterator& operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator& operator--()
+    {
+        ConstIterator::operator--();
+        return *this;
+    }
+
+    Iterator operator--(int)
+    {
+        auto result = *this;
+        ConstIterator::operator--();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    Iterator operator-(difference_type d) const
+    {
+        return ConstIterator::operator-(d);
+    }
+
+    reference operator*() const
+    {
+        ConstIterator::operator*(); //bounds check
+        return reference(const_cast<SoaVector*>(this->parent), this->index);
+    }
+};
+
+}
+
+#endif // AISDI_LINEAR_SOAVECTOR_H
@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BenchmarkUtils.h"
+#include "Sorting.h"
+#include "Vector.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+
+struct Record
+{
+    std::uint32_t key;
+    std::uint32_t payload[3];
+};
+
+std::vector<std::int32_t> makeInput(const std::string& pattern, std::size_t size)
+{
+    std::vector<std::int32_t> items(size);
+    unsigned seed = 2016;
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        if(pattern == "random") items[i] = static_cast<std::int32_t>(seed);
+        else if(pattern == "sorted") items[i] = static_cast<std::int32_t>(i);
+        else if(pattern == "reversed") items[i] = static_cast<std::int32_t>(size - i);
+        else if(pattern == "16 distinct") items[i] = static_cast<std::int32_t>((seed >> 16) % 16);
+        else items[i] = static_cast<std::int32_t>(i % 1000 ? i : seed % size); //nearly sorted
+    }
+    return items;
+}
+
+aisdi::Vector<std::int32_t> toVector(const std::vector<std::int32_t>& items)
+{
+    aisdi::Vector<std::int32_t> vector;
+    vector.resize(items.size());
+    std::copy(items.begin(), items.end(), vector.data());
+    return vector;
+}
+
+template <typename Function>
+void measureRow(const std::string& name, const std::vector<std::int32_t>& input, Function sortVector)
+{
+    aisdi::Vector<std::int32_t> vector = toVector(input);
+    const double ms = measureMs([&]{ sortVector(vector); });
+    const bool sorted = std::is_sorted(vector.data(), vector.data() + vector.getSize());
+    std::cout << std::right << std::fixed << std::setprecision(1) << std::setw(9) << ms;
+    if(!sorted) std::cout << " (" << name << " not sorted!)";
+}
+
+void perfomTest(std::size_t size)
+{
+    const std::vector<std::string> patterns = { "random", "sorted", "reversed", "16 distinct", "nearly sorted" };
+    std::cout << size << " int32 elements [ms]" << std::endl << std::setw(14) << "";
+    for(const std::string& pattern : patterns)
+        std::cout << std::setw(15) << pattern;
+    std::cout << std::endl;
+
+    struct Algorithm
+    {
+        std::string name;
+        std::function<void(aisdi::Vector<std::int32_t>&)> run;
+    };
+    const std::vector<Algorithm> algorithms = {
+        { "std::sort", [](aisdi::Vector<std::int32_t>& v){ std::sort(v.data(), v.data() + v.getSize()); } },
+        { "std::stable_sort", [](aisdi::Vector<std::int32_t>& v){ std::stable_sort(v.data(), v.data() + v.getSize()); } },
+        { "pdq sort", [](aisdi::Vector<std::int32_t>& v){ aisdi::sort(v, std::less<std::int32_t>()); } },
+        { "merge sort", [](aisdi::Vector<std::int32_t>& v){ aisdi::stableSort(v, std::less<std::int32_t>()); } },
+        { "radix sort", [](aisdi::Vector<std::int32_t>& v){ aisdi::sort(v); } },
+    };
+    for(const Algorithm& algorithm : algorithms)
+    {
+        std::cout << std::left << std::setw(18) << algorithm.name;
+        for(const std::string& pattern : patterns)
+        {
+            std::cout << std::setw(6) << "";
+            measureRow(algorithm.name, makeInput(pattern, size), algorithm.run);
+        }
+        std::cout << std::endl;
+    }
+
+    //Records sorted by an integer member: comparator against key extractor
+    const std::vector<std::int32_t> keys = makeInput("random", size);
+    aisdi::Vector<Record> records;
+    records.resize(size);
+    for(std::size_t i = 0; i < size; ++i)
+        records.data()[i] = Record{ static_cast<std::uint32_t>(keys[i]), { 0, 0, 0 } };
+    aisdi::Vector<Record> copy = records;
+    const double compareMs = measureMs([&]
+    {
+        aisdi::stableSort(records, [](const Record& a, const Record& b) { return a.key < b.key; });
+    });
+    const double keyMs = measureMs([&]
+    {
+        aisdi::stableSortByKey(copy, [](const Record& record) { return record.key; });
+    });
+    std::cout << "16-byte records, stable: comparator " << compareMs << " ms, key extractor (radix) "
+              << keyMs << " ms" << std::endl;
+
+    std::vector<double> reals(size);
+    for(std::size_t i = 0; i < size; ++i)
+        reals[i] = static_cast<double>(keys[i]) / 3.0;
+    aisdi::Vector<double> radixReals;
+    radixReals.resize(size);
+    std::copy(reals.begin(), reals.end(), radixReals.data());
+    const double stdMs = measureMs([&]{ std::sort(reals.begin(), reals.end()); });
+    const double radixMs = measureMs([&]{ aisdi::sort(radixReals); });
+    std::cout << "random doubles: std::sort " << stdMs << " ms, radix sort " << radixMs << " ms" << std::endl;
+    if(!std::equal(reals.begin(), reals.end(), radixReals.data())) std::cout << "Results differ!" << std::endl;
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const std::size_t size = argc > 1 ? std::atoll(argv[1]) : 1000000;
+
+    perfomTest(size);
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
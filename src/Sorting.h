@@ -0,0 +1,492 @@
+#ifndef AISDI_LINEAR_SORTING_H
+#define AISDI_LINEAR_SORTING_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "BitOps.h"
+#include "Vector.h"
+
+namespace aisdi
+{
+namespace sorting
+{
+
+const std::size_t INSERTION_SORT_LIMIT = 24; //Ranges shorter than this are insertion sorted
+const std::size_t NINTHER_THRESHOLD = 128; //Ranges longer than this take the pivot as a median of medians
+const std::size_t PARTIAL_INSERTION_LIMIT = 8; //Moves an optimistic insertion sort may make before giving up
+const std::size_t MERGE_RUN = 32; //Length of the insertion-sorted runs the merge sort starts from
+const std::size_t RADIX_THRESHOLD = 64; //Shorter vectors are not worth the radix histograms
+const unsigned RADIX_BITS = 8;
+const std::size_t RADIX_BUCKETS = std::size_t(1) << RADIX_BITS;
+
+//Keys the radix sort understands: integers (except bool), float and double
+template <typename Key>
+struct IsRadixKey : std::integral_constant<bool,
+        (std::is_integral<Key>::value && !std::is_same<Key, bool>::value)
+        || std::is_same<Key, float>::value || std::is_same<Key, double>::value>
+{};
+
+//Map of a key to an unsigned integer which orders the same way
+template <typename Key, typename Enable = void>
+struct RadixKey;
+
+template <typename Key>
+struct RadixKey<Key, typename std::enable_if<std::is_integral<Key>::value>::type>
+{
+    using Bits = typename std::make_unsigned<Key>::type;
+
+    static Bits get(Key key)
+    {
+        //Flipping the sign bit moves negative numbers below the positive ones
+        const Bits sign = std::is_signed<Key>::value ? static_cast<Bits>(Bits(1) << (sizeof(Bits) * 8 - 1)) : Bits(0);
+        return static_cast<Bits>(static_cast<Bits>(key) ^ sign);
+    }
+};
+
+//IEEE 754 numbers order like sign-magnitude integers: negative ones get all their bits flipped,
+//positive ones only the sign bit. -0.0 sorts before 0.0 and NaNs end up at either end.
+template <typename Key>
+struct RadixKey<Key, typename std::enable_if<std::is_floating_point<Key>::value>::type>
+{
+    using Bits = typename std::conditional<sizeof(Key) == 4, std::uint32_t, std::uint64_t>::type;
+
+    static Bits get(Key key)
+    {
+        static_assert(sizeof(Key) == sizeof(Bits), "Only float and double keys are supported");
+        Bits bits;
+        std::memcpy(&bits, &key, sizeof(bits));
+        const Bits sign = Bits(1) << (sizeof(Bits) * 8 - 1);
+        return bits & sign ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | sign);
+    }
+};
+
+template <typename Type>
+struct Identity
+{
+    const Type& operator()(const Type& item) const
+    {
+        return item;
+    }
+};
+
+//Order of elements by the keys *keyOf* extracts
+template <typename KeyOf>
+struct KeyLess
+{
+    KeyOf keyOf;
+
+    template <typename Type>
+    bool operator()(const Type& a, const Type& b) const
+    {
+        return keyOf(a) < keyOf(b);
+    }
+};
+
+template <typename Type, typename KeyOf>
+struct KeyType
+{
+    using type = typename std::decay<decltype(std::declval<KeyOf&>()(std::declval<const Type&>()))>::type;
+};
+
+template <typename Type, typename Compare>
+void insertionSort(Type* first, Type* last, Compare comp)
+{
+    if(first == last) return;
+    for(Type* current = first + 1; current != last; ++current)
+    {
+        if(!comp(*current, *(current - 1))) continue;
+        Type temp = std::move(*current);
+        Type* hole = current;
+        do
+        {
+            *hole = std::move(*(hole - 1));
+            --hole;
+        } while(hole != first && comp(temp, *(hole - 1)));
+        *hole = std::move(temp);
+    }
+}
+
+//Insertion sort of a range preceded by an element not greater than any in it, which stops
+//every shift without a bound check
+template <typename Type, typename Compare>
+void unguardedInsertionSort(Type* first, Type* last, Compare comp)
+{
+    if(first == last) return;
+    for(Type* current = first + 1; current != last; ++current)
+    {
+        if(!comp(*current, *(current - 1))) continue;
+        Type temp = std::move(*current);
+        Type* hole = current;
+        do
+        {
+            *hole = std::move(*(hole - 1));
+            --hole;
+        } while(comp(temp, *(hole - 1)));
+        *hole = std::move(temp);
+    }
+}
+
+//Insertion sort which gives up after PARTIAL_INSERTION_LIMIT moves. Returns true when the range
+//ended up sorted.
+template <typename Type, typename Compare>
+bool partialInsertionSort(Type* first, Type* last, Compare comp)
+{
+    if(first == last) return true;
+    std::size_t moves = 0;
+    for(Type* current = first + 1; current != last; ++current)
+    {
+        if(!comp(*current, *(current - 1))) continue;
+        Type temp = std::move(*current);
+        Type* hole = current;
+        do
+        {
+            *hole = std::move(*(hole - 1));
+            --hole;
+        } while(hole != first && comp(temp, *(hole - 1)));
+        *hole = std::move(temp);
+        moves += current - hole;
+        if(moves > PARTIAL_INSERTION_LIMIT) return current + 1 == last;
+    }
+    return true;
+}
+
+template <typename Type, typename Compare>
+void sort2(Type* a, Type* b, Compare comp)
+{
+    if(comp(*b, *a)) std::iter_swap(a, b);
+}
+
+template <typename Type, typename Compare>
+void sort3(Type* a, Type* b, Type* c, Compare comp)
+{
+    sort2(a, b, comp);
+    sort2(b, c, comp);
+    sort2(a, b, comp);
+}
+
+//Partition around the pivot at *first*, with elements equal to it going right. The median
+//selection left an element not less than the pivot at the end, so the first scan needs no
+//bound check. Returns the final pivot position and whether no element had to be swapped.
+template <typename Type, typename Compare>
+std::pair<Type*, bool> partitionRight(Type* first, Type* last, Compare comp)
+{
+    Type pivot = std::move(*first);
+    Type* left = first;
+    Type* right = last;
+    while(comp(*++left, pivot));
+    if(left - 1 == first)
+        while(left < right && !comp(*--right, pivot));
+    else
+        while(!comp(*--right, pivot));
+
+    const bool alreadyPartitioned = left >= right;
+    while(left < right)
+    {
+        std::iter_swap(left, right);
+        while(comp(*++left, pivot));
+        while(!comp(*--right, pivot));
+    }
+
+    Type* pivotPosition = left - 1;
+    *first = std::move(*pivotPosition);
+    *pivotPosition = std::move(pivot);
+    return std::make_pair(pivotPosition, alreadyPartitioned);
+}
+
+//Partition around the pivot at *first*, with elements equal to it going left. Used when the
+//pivot equals the element before the range: everything equal to it is then already in place.
+template <typename Type, typename Compare>
+Type* partitionLeft(Type* first, Type* last, Compare comp)
+{
+    Type pivot = std::move(*first);
+    Type* left = first;
+    Type* right = last;
+    while(comp(pivot, *--right));
+    if(right + 1 == last)
+        while(left < right && !comp(pivot, *++left));
+    else
+        while(!comp(pivot, *++left));
+
+    while(left < right)
+    {
+        std::iter_swap(left, right);
+        while(comp(pivot, *--right));
+        while(!comp(pivot, *++left));
+    }
+
+    *first = std::move(*right);
+    *right = std::move(pivot);
+    return right;
+}
+
+//Swap a few elements of a range to break up a pattern which produced an unbalanced partition
+template <typename Type>
+void breakPatterns(Type* first, Type* last)
+{
+    const std::size_t size = last - first;
+    if(size < INSERTION_SORT_LIMIT) return;
+    const std::size_t quarter = size / 4;
+    std::iter_swap(first, first + quarter);
+    std::iter_swap(last - 1, last - quarter);
+    if(size > NINTHER_THRESHOLD)
+    {
+        std::iter_swap(first + 1, first + (quarter + 1));
+        std::iter_swap(first + 2, first + (quarter + 2));
+        std::iter_swap(last - 2, last - (quarter + 1));
+        std::iter_swap(last - 3, last - (quarter + 2));
+    }
+}
+
+//Pattern-defeating quicksort: introsort that detects sorted and equal runs in linear time and
+//shuffles the input when partitions keep coming out unbalanced. *badAllowed* unbalanced
+//partitions are tolerated before the range is heapsorted, which bounds the worst case to
+//O(n log n). The smaller side is recursed into, so the stack depth stays logarithmic.
+template <typename Type, typename Compare>
+void pdqSort(Type* first, Type* last, Compare comp, unsigned badAllowed, bool leftmost)
+{
+    for(;;)
+    {
+        const std::size_t size = last - first;
+        if(size < INSERTION_SORT_LIMIT)
+        {
+            if(leftmost) insertionSort(first, last, comp);
+            else unguardedInsertionSort(first, last, comp);
+            return;
+        }
+
+        const std::size_t half = size / 2;
+        if(size > NINTHER_THRESHOLD)
+        {
+            sort3(first, first + half, last - 1, comp);
+            sort3(first + 1, first + (half - 1), last - 2, comp);
+            sort3(first + 2, first + (half + 1), last - 3, comp);
+            sort3(first + (half - 1), first + half, first + (half + 1), comp);
+            std::iter_swap(first, first + half);
+        }
+        else
+            sort3(first + half, first, last - 1, comp);
+
+        if(!leftmost && !comp(*(first - 1), *first))
+        {
+            first = partitionLeft(first, last, comp) + 1;
+            continue;
+        }
+
+        const std::pair<Type*, bool> partition = partitionRight(first, last, comp);
+        Type* pivot = partition.first;
+        const std::size_t leftSize = pivot - first;
+        const std::size_t rightSize = last - (pivot + 1);
+
+        if(leftSize < size / 8 || rightSize < size / 8)
+        {
+            if(--badAllowed == 0)
+            {
+                std::make_heap(first, last, comp);
+                std::sort_heap(first, last, comp);
+                return;
+            }
+            breakPatterns(first, pivot);
+            breakPatterns(pivot + 1, last);
+        }
+        else if(partition.second && partialInsertionSort(first, pivot, comp)
+                && partialInsertionSort(pivot + 1, last, comp))
+            return;
+
+        if(leftSize < rightSize)
+        {
+            pdqSort(first, pivot, comp, badAllowed, leftmost);
+            first = pivot + 1;
+            leftmost = false;
+        }
+        else
+        {
+            pdqSort(pivot + 1, last, comp, badAllowed, false);
+            last = pivot;
+        }
+    }
+}
+
+template <typename Type, typename Compare>
+void pdqSort(Type* first, Type* last, Compare comp)
+{
+    const std::size_t size = last - first;
+    if(size < 2) return;
+    pdqSort(first, last, comp, bits::WORD_BITS - bits::countLeadingZeros(size), true);
+}
+
+//Bottom-up merge sort: insertion-sorted runs of MERGE_RUN, then passes merging neighbouring
+//runs back and forth between the data and a scratch buffer. Pairs of runs that are already in
+//order are only copied.
+template <typename Type, typename Compare>
+void mergeSort(Type* data, std::size_t size, Compare comp)
+{
+    if(size < 2) return;
+    for(std::size_t begin = 0; begin < size; begin += MERGE_RUN)
+        insertionSort(data + begin, data + std::min(begin + MERGE_RUN, size), comp);
+    if(size <= MERGE_RUN) return;
+
+    std::unique_ptr<Type[]> scratch(new Type[size]);
+    Type* from = data;
+    Type* to = scratch.get();
+    for(std::size_t width = MERGE_RUN; width < size; width *= 2)
+    {
+        for(std::size_t begin = 0; begin < size; begin += 2 * width)
+        {
+            const std::size_t middle = std::min(begin + width, size);
+            const std::size_t end = std::min(begin + 2 * width, size);
+            if(middle == end || !comp(from[middle], from[middle - 1]))
+                std::move(from + begin, from + end, to + begin);
+            else
+                std::merge(std::make_move_iterator(from + begin), std::make_move_iterator(from + middle),
+                           std::make_move_iterator(from + middle), std::make_move_iterator(from + end),
+                           to + begin, comp);
+        }
+        std::swap(from, to);
+    }
+    if(from != data) std::move(from, from + size, data);
+}
+
+//Stable LSD radix sort by the keys *keyOf* extracts, RADIX_BITS per pass. The histograms of all
+//passes are counted in a single read of the data, and passes in which every key has the same
+//digit are skipped, so narrow value ranges cost fewer passes than the key width suggests.
+template <typename Type, typename KeyOf>
+void radixSort(Type* data, std::size_t size, KeyOf keyOf)
+{
+    using Key = typename KeyType<Type, KeyOf>::type;
+    using Bits = typename RadixKey<Key>::Bits;
+    const unsigned passes = (sizeof(Bits) * 8 + RADIX_BITS - 1) / RADIX_BITS;
+    if(size < 2) return;
+
+    //Scanning for the first descent costs little on unsorted input and saves every pass on sorted one
+    std::size_t sortedPrefix = 1;
+    while(sortedPrefix < size
+          && !(RadixKey<Key>::get(keyOf(data[sortedPrefix])) < RadixKey<Key>::get(keyOf(data[sortedPrefix - 1]))))
+        ++sortedPrefix;
+    if(sortedPrefix == size) return;
+
+    std::size_t counts[passes][RADIX_BUCKETS] = {};
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        const Bits bits = RadixKey<Key>::get(keyOf(data[i]));
+        for(unsigned pass = 0; pass < passes; ++pass)
+            ++counts[pass][(bits >> (pass * RADIX_BITS)) & (RADIX_BUCKETS - 1)];
+    }
+
+    std::unique_ptr<Type[]> scratch;
+    Type* from = data;
+    Type* to = nullptr;
+    for(unsigned pass = 0; pass < passes; ++pass)
+    {
+        const unsigned shift = pass * RADIX_BITS;
+        std::size_t* offsets = counts[pass];
+        if(offsets[(RadixKey<Key>::get(keyOf(from[0])) >> shift) & (RADIX_BUCKETS - 1)] == size) continue;
+
+        if(!scratch)
+        {
+            scratch.reset(new Type[size]);
+            to = scratch.get();
+        }
+        std::size_t offset = 0;
+        for(std::size_t bucket = 0; bucket < RADIX_BUCKETS; ++bucket)
+        {
+            const std::size_t count = offsets[bucket];
+            offsets[bucket] = offset;
+            offset += count;
+        }
+        for(std::size_t i = 0; i < size; ++i)
+            to[offsets[(RadixKey<Key>::get(keyOf(from[i])) >> shift) & (RADIX_BUCKETS - 1)]++] = std::move(from[i]);
+        std::swap(from, to);
+    }
+    if(from != data) std::move(from, from + size, data);
+}
+
+template <typename Type, typename KeyOf>
+void sortByKey(Type* data, std::size_t size, KeyOf keyOf, std::true_type /*radix*/)
+{
+    if(size < RADIX_THRESHOLD) pdqSort(data, data + size, KeyLess<KeyOf>{ keyOf });
+    else radixSort(data, size, keyOf);
+}
+
+template <typename Type, typename KeyOf>
+void sortByKey(Type* data, std::size_t size, KeyOf keyOf, std::false_type /*radix*/)
+{
+    pdqSort(data, data + size, KeyLess<KeyOf>{ keyOf });
+}
+
+template <typename Type, typename KeyOf>
+void stableSortByKey(Type* data, std::size_t size, KeyOf keyOf, std::true_type /*radix*/)
+{
+    if(size < RADIX_THRESHOLD) mergeSort(data, size, KeyLess<KeyOf>{ keyOf });
+    else radixSort(data, size, keyOf);
+}
+
+template <typename Type, typename KeyOf>
+void stableSortByKey(Type* data, std::size_t size, KeyOf keyOf, std::false_type /*radix*/)
+{
+    mergeSort(data, size, KeyLess<KeyOf>{ keyOf });
+}
+
+}
+
+//Sort *vector* so that no element compares less than the one before it. Not stable.
+template <typename Type, typename Compare>
+void sort(Vector<Type>& vector, Compare comp)
+{
+    if(vector.getSize() < 2) return;
+    sorting::pdqSort(vector.data(), vector.data() + vector.getSize(), comp);
+}
+
+//Sort *vector* in ascending order. Integer and floating-point elements are radix sorted.
+template <typename Type>
+void sort(Vector<Type>& vector)
+{
+    if(vector.getSize() < 2) return;
+    sorting::sortByKey(vector.data(), vector.getSize(), sorting::Identity<Type>(),
+                       sorting::IsRadixKey<Type>());
+}
+
+//Sort *vector* in ascending order of keyOf(element), radix sorting integer and floating-point keys.
+//*keyOf* is called several times per element, so it should be cheap.
+template <typename Type, typename KeyOf>
+void sortByKey(Vector<Type>& vector, KeyOf keyOf)
+{
+    if(vector.getSize() < 2) return;
+    sorting::sortByKey(vector.data(), vector.getSize(), keyOf,
+                       sorting::IsRadixKey<typename sorting::KeyType<Type, KeyOf>::type>());
+}
+
+//Like sort, but elements which compare equal keep their relative order
+template <typename Type, typename Compare>
+void stableSort(Vector<Type>& vector, Compare comp)
+{
+    if(vector.getSize() < 2) return;
+    sorting::mergeSort(vector.data(), vector.getSize(), comp);
+}
+
+template <typename Type>
+void stableSort(Vector<Type>& vector)
+{
+    if(vector.getSize() < 2) return;
+    sorting::stableSortByKey(vector.data(), vector.getSize(), sorting::Identity<Type>(),
+                             sorting::IsRadixKey<Type>());
+}
+
+template <typename Type, typename KeyOf>
+void stableSortByKey(Vector<Type>& vector, KeyOf keyOf)
+{
+    if(vector.getSize() < 2) return;
+    sorting::stableSortByKey(vector.data(), vector.getSize(), keyOf,
+                             sorting::IsRadixKey<typename sorting::KeyType<Type, KeyOf>::type>());
+}
+
+}
+
+#endif // AISDI_LINEAR_SORTING_H
@@ -0,0 +1,57 @@
+#ifndef AISDI_LINEAR_SPAN_H
+#define AISDI_LINEAR_SPAN_H
+
+#include <cstddef>
+#include <type_traits>
+
+namespace aisdi
+{
+
+//Non-owning view of contiguous elements, e.g. a column of a SoaVector or a mapped payload.
+//It is invalidated together with the storage it points to.
+template <typename Type>
+class Span
+{
+public:
+    using size_type = std::size_t;
+    using value_type = typename std::remove_const<Type>::type;
+    using pointer = Type*;
+    using reference = Type&;
+
+private:
+    pointer values;
+    size_type size;
+
+public:
+    Span(pointer v, size_type s) : values(v), size(s)
+    {}
+
+    pointer data() const
+    {
+        return values;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    reference operator[](size_type i) const
+    {
+        return values[i];
+    }
+
+    pointer begin() const
+    {
+        return values;
+    }
+
+    pointer end() const
+    {
+        return values + size;
+    }
+};
+
+}
+
+#endif // AISDI_LINEAR_SPAN_H
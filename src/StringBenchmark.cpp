@@ -0,0 +1,115 @@
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "BenchmarkUtils.h"
+#include "StringVector.h"
+#include "Vector.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+
+//Strings a std::string cannot keep in its small buffer, drawn from *distinct* values
+std::string longWord(std::size_t i, std::size_t distinct)
+{
+    return "column value number " + std::to_string(i % distinct);
+}
+
+void printRow(const std::string& name, std::size_t bytes, double appendMs, double scanMs, double eraseMs)
+{
+    std::cout << std::left << std::setw(30) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << bytes / 1024 << std::setw(10) << appendMs << std::setw(10) << scanMs
+              << std::setw(10) << eraseMs << std::endl;
+}
+
+//Heap bytes of a std::string, assuming the 15-character small buffer of libstdc++
+std::size_t heapBytes(const std::string& text)
+{
+    return text.capacity() > 15 ? text.capacity() + 1 : 0;
+}
+
+template <typename Make>
+void measureStrings(std::size_t size, Make make)
+{
+    aisdi::Vector<std::string> strings;
+    const double appendMs = measureMs([&]
+    {
+        for(std::size_t i = 0; i < size; ++i)
+            strings.append(make(i));
+    });
+
+    std::size_t characters = 0, bytes = strings.getCapacity() * sizeof(std::string);
+    const double scanMs = measureMs([&]
+    {
+        for(std::size_t i = 0; i < size; ++i)
+            characters += strings.data()[i].size();
+    });
+    for(std::size_t i = 0; i < size; ++i)
+        bytes += heapBytes(strings.data()[i]);
+
+    //A hundred single erases near the front, which move the rest of the vector each time
+    const double eraseMs = measureMs([&]
+    {
+        for(std::size_t i = 0; i < 100 && i < strings.getSize(); ++i)
+            strings.erase(strings.begin() + i);
+    });
+    printRow("Vector<std::string>", bytes, appendMs, scanMs, eraseMs);
+    if(characters == 1) std::cout << "Results differ!" << std::endl;
+}
+
+template <typename Make>
+void measureArena(const std::string& name, std::size_t size, aisdi::Interning interning, Make make)
+{
+    aisdi::StringVector strings(interning);
+    const double appendMs = measureMs([&]
+    {
+        for(std::size_t i = 0; i < size; ++i)
+            strings.append(make(i));
+    });
+
+    std::size_t characters = 0;
+    const std::size_t bytes = strings.getAllocatedBytes();
+    const double scanMs = measureMs([&]
+    {
+        for(std::size_t i = 0; i < size; ++i)
+            characters += strings[i].getSize();
+    });
+
+    const double eraseMs = measureMs([&]
+    {
+        for(std::size_t i = 0; i < 100 && i < strings.getSize(); ++i)
+            strings.erase(strings.begin() + i);
+    });
+    printRow(name, bytes, appendMs, scanMs, eraseMs);
+    if(characters == 1) std::cout << "Results differ!" << std::endl;
+}
+
+template <typename Make>
+void perfomTest(const std::string& title, std::size_t size, Make make)
+{
+    std::cout << size << " strings, " << title << std::endl
+              << std::left << std::setw(30) << "" << std::right << std::setw(12) << "KiB" << std::setw(10) << "append"
+              << std::setw(10) << "scan" << std::setw(10) << "erase" << "   [ms]" << std::endl;
+    measureStrings(size, make);
+    measureArena("StringVector", size, aisdi::Interning::Disabled, make);
+    measureArena("StringVector (interning)", size, aisdi::Interning::Enabled, make);
+    std::cout << std::endl;
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const std::size_t size = argc > 1 ? std::atoll(argv[1]) : 1000000;
+
+    perfomTest("\"TODO\" as in main.cpp", size, [](std::size_t) { return std::string("TODO"); });
+    perfomTest("1000 distinct long values", size, [](std::size_t i) { return longWord(i, 1000); });
+    perfomTest("all distinct long values", size, [size](std::size_t i) { return longWord(i, size); });
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,406 @@
+#ifndef AISDI_LINEAR_STRINGVECTOR_H
+#define AISDI_LINEAR_STRINGVECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include "StringView.h"
+#include "Vector.h"
+
+namespace aisdi
+{
+
+//Whether a StringVector stores equal strings once
+enum class Interning
+{
+    Disabled,
+    Enabled //Appending a string already in the arena only adds an entry pointing at it
+};
+
+//Vector of strings keeping all characters in one arena, with an 8-byte entry (offset and length)
+//per element instead of a std::string and its own heap block. Elements are read as StringViews,
+//which stay valid until the next append, insert or compaction.
+//Erasing only drops the entry; the characters become garbage and are compacted away once they
+//exceed *compactionRatio* of the arena. The arena holds up to 4 GiB.
+class StringVector
+{
+public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = StringView;
+    using const_reference = StringView;
+
+    class ConstIterator;
+    using const_iterator = ConstIterator;
+    using iterator = ConstIterator;
+
+private:
+    struct Entry
+    {
+        std::uint32_t offset;
+        std::uint32_t length;
+    };
+
+    //Slot of the interning table, referring to characters in the arena
+    struct Slot
+    {
+        std::uint32_t hash;
+        std::uint32_t offset;
+        std::uint32_t length;
+        std::uint32_t references; //Entries sharing the characters, they are garbage at zero
+    };
+
+    static const std::uint32_t EMPTY_SLOT = static_cast<std::uint32_t>(-1);
+
+    Vector<char> arena;
+    Vector<Entry> entries;
+    Vector<Slot> table; //Open addressing with linear probing, power-of-two size
+    size_type tableUsed;
+    size_type garbageBytes; //Characters no entry refers to
+    double compactionRatio;
+    Interning interning;
+
+    static std::uint32_t hashOf(StringView text)
+    {
+        std::uint32_t hash = 2166136261u; //FNV-1a
+        for(char c : text)
+            hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+        return hash;
+    }
+
+    StringView viewOf(std::uint32_t offset, std::uint32_t length) const
+    {
+        return length ? StringView(arena.data() + offset, length) : StringView();
+    }
+
+    //Copy *text* to the end of the arena, growing it geometrically.
+    //*text* may point into the arena itself, so it is located again after the arena grows.
+    std::uint32_t store(StringView text)
+    {
+        const size_type offset = arena.getSize();
+        const size_type needed = offset + text.getSize();
+        if(needed > UINT32_MAX) throw std::length_error("String arena is full");
+        const bool inArena = !text.isEmpty() && std::less_equal<const char*>()(arena.data(), text.data())
+                             && std::less<const char*>()(text.data(), arena.data() + offset);
+        const size_type source = inArena ? text.data() - arena.data() : 0;
+        if(needed > arena.getCapacity()) arena.reserve(std::max(needed, arena.getCapacity() + arena.getCapacity() / 2));
+        arena.resize(needed);
+        const char* characters = inArena ? arena.data() + source : text.data();
+        if(!text.isEmpty()) std::memcpy(arena.data() + offset, characters, text.getSize());
+        return static_cast<std::uint32_t>(offset);
+    }
+
+    void rehash(size_type newSize)
+    {
+        Vector<Slot> old;
+        swap(old, table);
+        table.resize(newSize);
+        for(size_type i = 0; i < newSize; ++i)
+            table.data()[i].offset = EMPTY_SLOT;
+        for(size_type i = 0; i < old.getSize(); ++i)
+            if(old.data()[i].offset != EMPTY_SLOT) placeSlot(old.data()[i]);
+    }
+
+    void placeSlot(const Slot& slot)
+    {
+        const size_type mask = table.getSize() - 1;
+        size_type i = slot.hash & mask;
+        while(table.data()[i].offset != EMPTY_SLOT)
+            i = (i + 1) & mask;
+        table.data()[i] = slot;
+    }
+
+    //Entry for *text*, reusing equal characters already in the arena when interning
+    Entry entryFor(StringView text)
+    {
+        if(interning == Interning::Disabled || text.isEmpty())
+            return Entry{ text.isEmpty() ? 0 : store(text), static_cast<std::uint32_t>(text.getSize()) };
+
+        if(2 * (tableUsed + 1) > table.getSize()) rehash(std::max<size_type>(16, 2 * table.getSize()));
+        const std::uint32_t hash = hashOf(text);
+        const size_type mask = table.getSize() - 1;
+        for(size_type i = hash & mask;; i = (i + 1) & mask)
+        {
+            Slot& slot = table.data()[i];
+            if(slot.offset == EMPTY_SLOT)
+            {
+                const std::uint32_t length = static_cast<std::uint32_t>(text.getSize());
+                slot = Slot{ hash, store(text), length, 1 };
+                ++tableUsed;
+                return Entry{ slot.offset, length };
+            }
+            if(slot.hash == hash && viewOf(slot.offset, slot.length) == text)
+            {
+                if(slot.references++ == 0) garbageBytes -= slot.length;
+                return Entry{ slot.offset, slot.length };
+            }
+        }
+    }
+
+    //Drop the reference of an erased entry to its characters
+    void release(const Entry& entry)
+    {
+        if(interning == Interning::Disabled || entry.length == 0)
+        {
+            garbageBytes += entry.length;
+            return;
+        }
+        const size_type mask = table.getSize() - 1;
+        size_type i = hashOf(viewOf(entry.offset, entry.length)) & mask;
+        while(table.data()[i].offset != entry.offset)
+            i = (i + 1) & mask;
+        if(--table.data()[i].references == 0) garbageBytes += entry.length;
+    }
+
+    void collectGarbage()
+    {
+        if(garbageBytes > 0 && garbageBytes >= compactionRatio * arena.getSize()) compact();
+    }
+
+public:
+    explicit StringVector(Interning i = Interning::Disabled, double ratio = 0.25)
+        : tableUsed(0), garbageBytes(0), compactionRatio(ratio), interning(i)
+    {}
+
+    StringVector(std::initializer_list<StringView> l) : StringVector()
+    {
+        for(StringView item : l)
+            append(item);
+    }
+
+    bool isEmpty() const
+    {
+        return entries.isEmpty();
+    }
+
+    size_type getSize() const
+    {
+        return entries.getSize();
+    }
+
+    //Characters in the arena, including the garbage left by erased strings
+    size_type getArenaSize() const
+    {
+        return arena.getSize();
+    }
+
+    //Bytes allocated for the arena, the entries and the interning table
+    size_type getAllocatedBytes() const
+    {
+        return arena.getCapacity() + entries.getCapacity() * sizeof(Entry) + table.getCapacity() * sizeof(Slot);
+    }
+
+    //Make sure *count* strings with *characters* characters in total fit without reallocation
+    void reserve(size_type count, size_type characters)
+    {
+        entries.reserve(count);
+        arena.reserve(characters);
+    }
+
+    StringView operator[](size_type index) const
+    {
+        const Entry& entry = entries.data()[index];
+        return viewOf(entry.offset, entry.length);
+    }
+
+    StringView at(size_type index) const
+    {
+        if(index >= getSize()) throw std::out_of_range("Index out of range");
+        return (*this)[index];
+    }
+
+    void append(StringView item)
+    {
+        entries.append(entryFor(item));
+    }
+
+    void prepend(StringView item)
+    {
+        entries.prepend(entryFor(item));
+    }
+
+    void insert(const const_iterator& insertPosition, StringView item);
+
+    std::string popFirst()
+    {
+        if(isEmpty()) throw std::logic_error("Vector is empty");
+        const std::string temp = (*this)[0].toString();
+        erase(0, 1);
+        return temp;
+    }
+
+    std::string popLast()
+    {
+        if(isEmpty()) throw std::logic_error("Vector is empty");
+        const std::string temp = (*this)[getSize() - 1].toString();
+        erase(getSize() - 1, getSize());
+        return temp;
+    }
+
+    void erase(const const_iterator& possition);
+    void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded);
+
+    //Remove the strings at positions [first, last), compacting the arena if enough of it is garbage
+    void erase(size_type first, size_type last)
+    {
+        if(isEmpty()) throw std::out_of_range("Vector is empty");
+        if(first > last || last > getSize()) throw std::out_of_range("firstIncluded should be before lastExcluded");
+        Entry* items = entries.data();
+        for(size_type i = first; i < last; ++i)
+            release(items[i]);
+        std::copy(items + last, items + getSize(), items + first);
+        entries.resize(getSize() - (last - first));
+        collectGarbage();
+    }
+
+    //Copy the strings still in the vector to a new arena, in order, and forget the garbage
+    void compact()
+    {
+        Vector<char> old;
+        swap(old, arena);
+        arena.reserve(old.getSize() - std::min(old.getSize(), garbageBytes));
+        table = Vector<Slot>();
+        tableUsed = 0;
+        garbageBytes = 0;
+        Entry* items = entries.data();
+        for(size_type i = 0; i < getSize(); ++i)
+        {
+            const StringView text = items[i].length ? StringView(old.data() + items[i].offset, items[i].length) : StringView();
+            items[i] = entryFor(text);
+        }
+    }
+
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+};
+
+class StringVector::ConstIterator
+{
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = StringView;
+    using difference_type = StringVector::difference_type;
+    using pointer = void;
+    using reference = StringView;
+
+private:
+    const StringVector* parent;
+    size_type index;
+
+public:
+    explicit ConstIterator()
+    {}
+
+    ConstIterator(const StringVector* p, size_type i) : parent(p), index(i)
+    {}
+
+    reference operator*() const
+    {
+        if(index >= parent->getSize()) throw std::out_of_range("Iterator points at empty space after the last element");
+        return (*parent)[index];
+    }
+
+    ConstIterator& operator++()
+    {
+        if(index >= parent->getSize()) throw std::out_of_range("Cannot increment iterator");
+        ++index;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    ConstIterator& operator--()
+    {
+        if(index == 0) throw std::out_of_range("Cannot decrement iterator");
+        --index;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        return ConstIterator(parent, index + d);
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        return ConstIterator(parent, index - d);
+    }
+
+    bool operator==(const ConstIterator& other) const
+    {
+        return index == other.index;
+    }
+
+    bool operator!=(const ConstIterator& other) const
+    {
+        return index != other.index;
+    }
+
+    //Position of the iterator in its vector
+    size_type getIndex() const
+    {
+        return index;
+    }
+};
+
+inline void StringVector::insert(const const_iterator& insertPosition, StringView item)
+{
+    if(insertPosition.getIndex() > getSize()) throw std::out_of_range("Index out of range");
+    const Entry entry = entryFor(item);
+    entries.insert(entries.begin() + insertPosition.getIndex(), entry);
+}
+
+inline void StringVector::erase(const const_iterator& possition)
+{
+    erase(possition.getIndex(), possition.getIndex() + 1);
+}
+
+inline void StringVector::erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded)
+{
+    erase(firstIncluded.getIndex(), lastExcluded.getIndex());
+}
+
+inline StringVector::const_iterator StringVector::cbegin() const
+{
+    return const_iterator(this, 0);
+}
+
+inline StringVector::const_iterator StringVector::cend() const
+{
+    return const_iterator(this, getSize());
+}
+
+inline StringVector::const_iterator StringVector::begin() const
+{
+    return cbegin();
+}
+
+inline StringVector::const_iterator StringVector::end() const
+{
+    return cend();
+}
+
+}
+
+#endif // AISDI_LINEAR_STRINGVECTOR_H
@@ -0,0 +1,99 @@
+#ifndef AISDI_LINEAR_STRINGVIEW_H
+#define AISDI_LINEAR_STRINGVIEW_H
+
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+namespace aisdi
+{
+
+//Non-owning view of a sequence of characters, standing in for std::string_view under C++11.
+//It is invalidated together with the storage it points to.
+class StringView
+{
+public:
+    using size_type = std::size_t;
+    using value_type = char;
+    using const_pointer = const char*;
+
+private:
+    const_pointer characters;
+    size_type size;
+
+public:
+    StringView() : characters(""), size(0)
+    {}
+
+    StringView(const_pointer c, size_type s) : characters(c), size(s)
+    {}
+
+    StringView(const_pointer c) : characters(c), size(std::strlen(c))
+    {}
+
+    StringView(const std::string& s) : characters(s.data()), size(s.size())
+    {}
+
+    const_pointer data() const
+    {
+        return characters;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    bool isEmpty() const
+    {
+        return size == 0;
+    }
+
+    char operator[](size_type i) const
+    {
+        return characters[i];
+    }
+
+    const_pointer begin() const
+    {
+        return characters;
+    }
+
+    const_pointer end() const
+    {
+        return characters + size;
+    }
+
+    std::string toString() const
+    {
+        return std::string(characters, size);
+    }
+};
+
+inline bool operator==(const StringView& a, const StringView& b)
+{
+    return a.getSize() == b.getSize() && (a.isEmpty() || std::memcmp(a.data(), b.data(), a.getSize()) == 0);
+}
+
+inline bool operator!=(const StringView& a, const StringView& b)
+{
+    return !(a == b);
+}
+
+//Lexicographic order of the characters compared as unsigned char
+inline bool operator<(const StringView& a, const StringView& b)
+{
+    const std::size_t common = a.getSize() < b.getSize() ? a.getSize() : b.getSize();
+    const int order = common ? std::memcmp(a.data(), b.data(), common) : 0;
+    return order < 0 || (order == 0 && a.getSize() < b.getSize());
+}
+
+inline std::ostream& operator<<(std::ostream& stream, const StringView& view)
+{
+    return stream.write(view.data(), static_cast<std::streamsize>(view.getSize()));
+}
+
+}
+
+#endif // AISDI_LINEAR_STRINGVIEW_H
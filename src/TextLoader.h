@@ -0,0 +1,366 @@
+#ifndef AISDI_LINEAR_TEXTLOADER_H
+#define AISDI_LINEAR_TEXTLOADER_H
+
+#include <cerrno>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ParallelAlgorithms.h"
+#include "ThreadPool.h"
+#include "Vector.h"
+
+namespace aisdi
+{
+namespace text
+{
+
+const std::size_t CHUNK_BYTES = 1024 * 1024; //Amount of text parsed by a single task
+
+namespace detail
+{
+
+inline bool isBlank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline bool isDigit(char c)
+{
+    return static_cast<unsigned>(c - '0') < 10;
+}
+
+inline std::runtime_error malformed(const char* begin, const char* at)
+{
+    return std::runtime_error("Cannot parse number at byte " + std::to_string(at - begin));
+}
+
+//Integers: optional sign and decimal digits, range-checked
+template <typename Type>
+typename std::enable_if<std::is_integral<Type>::value, bool>::type
+parseNumber(const char*& p, const char* end, Type& value)
+{
+    using Unsigned = typename std::make_unsigned<Type>::type;
+    const char* start = p;
+    bool negative = false;
+    if(p != end && (*p == '-' || *p == '+'))
+    {
+        negative = *p == '-';
+        ++p;
+    }
+    if(negative && !std::is_signed<Type>::value) return false;
+
+    const Unsigned limit = negative ? Unsigned(Unsigned(std::numeric_limits<Type>::max()) + 1)
+                                    : Unsigned(std::numeric_limits<Type>::max());
+    Unsigned result = 0;
+    const char* digits = p;
+    for(; p != end && isDigit(*p); ++p)
+    {
+        const Unsigned digit = *p - '0';
+        if(result > (limit - digit) / 10)
+        {
+            p = start;
+            return false;
+        }
+        result = result * 10 + digit;
+    }
+    if(p == digits)
+    {
+        p = start;
+        return false;
+    }
+    value = negative ? Type(Unsigned(0) - result) : Type(result);
+    return true;
+}
+
+//Largest mantissa and power of ten that are exact in Type, so that their product or quotient
+//is rounded only once (exactly like the standard library)
+template <typename Type>
+struct ExactLimits
+{
+    static const std::uint64_t MANTISSA = 1ULL << 53;
+    static const int EXPONENT = 22;
+};
+
+template <>
+struct ExactLimits<float>
+{
+    static const std::uint64_t MANTISSA = 1ULL << 24;
+    static const int EXPONENT = 10;
+};
+
+inline float toFloating(const char* token, char** parsed, float)
+{
+    return std::strtof(token, parsed);
+}
+
+inline double toFloating(const char* token, char** parsed, double)
+{
+    return std::strtod(token, parsed);
+}
+
+inline long double toFloating(const char* token, char** parsed, long double)
+{
+    return std::strtold(token, parsed);
+}
+
+//Floating point: when the mantissa and the power of ten are both exact in Type, the value is
+//computed with a single rounding in Type itself (skipped where the compiler evaluates in a wider
+//type, which would round twice). Everything else, including inf, nan and hexadecimal floats,
+//goes through strtof, strtod or strtold for the matching Type, so results match the standard library.
+template <typename Type>
+typename std::enable_if<std::is_floating_point<Type>::value, bool>::type
+parseNumber(const char*& p, const char* end, Type& value)
+{
+    static const double powers[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                     1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    const char* start = p;
+    bool negative = false;
+    if(p != end && (*p == '-' || *p == '+'))
+    {
+        negative = *p == '-';
+        ++p;
+    }
+
+    std::uint64_t mantissa = 0;
+    int exponent = 0, digits = 0;
+    bool exact = true;
+    for(; p != end && isDigit(*p); ++p, ++digits)
+    {
+        if(mantissa < 1000000000000000000ULL) mantissa = mantissa * 10 + (*p - '0');
+        else
+        {
+            ++exponent;
+            exact = false;
+        }
+    }
+    if(p != end && (*p == 'x' || *p == 'X')) exact = false; //Hexadecimal, left to the standard library
+    if(p != end && *p == '.')
+    {
+        for(++p; p != end && isDigit(*p); ++p, ++digits)
+        {
+            if(mantissa < 1000000000000000000ULL)
+            {
+                mantissa = mantissa * 10 + (*p - '0');
+                --exponent;
+            }
+            else exact = false;
+        }
+    }
+    if(digits > 0 && p != end && (*p == 'e' || *p == 'E'))
+    {
+        int explicitExponent = 0;
+        const char* exponentStart = p;
+        if(parseNumber(++p, end, explicitExponent) && explicitExponent > -10000 && explicitExponent < 10000)
+            exponent += explicitExponent;
+        else
+        {
+            p = exponentStart;
+            exact = false;
+        }
+    }
+
+    const bool singleRounding = FLT_EVAL_METHOD == 0 || std::is_same<Type, long double>::value;
+    if(singleRounding && digits > 0 && exact && mantissa <= ExactLimits<Type>::MANTISSA
+       && exponent >= -ExactLimits<Type>::EXPONENT && exponent <= ExactLimits<Type>::EXPONENT)
+    {
+        const Type power = static_cast<Type>(powers[exponent < 0 ? -exponent : exponent]);
+        const Type result = exponent < 0 ? static_cast<Type>(mantissa) / power : static_cast<Type>(mantissa) * power;
+        value = negative ? -result : result;
+        return true;
+    }
+
+    //Slow path on a NUL-terminated copy of the token, the mapped text is not terminated
+    const char* tokenEnd = start;
+    while(tokenEnd != end && !isBlank(*tokenEnd) && *tokenEnd != '\n')
+        ++tokenEnd;
+    char shortToken[64];
+    std::string longToken;
+    const char* token = shortToken;
+    if(tokenEnd - start < static_cast<std::ptrdiff_t>(sizeof(shortToken)))
+    {
+        std::memcpy(shortToken, start, tokenEnd - start);
+        shortToken[tokenEnd - start] = '\0';
+    }
+    else
+    {
+        longToken.assign(start, tokenEnd);
+        token = longToken.c_str();
+    }
+    char* parsed = nullptr;
+    errno = 0;
+    const Type result = toFloating(token, &parsed, Type());
+    if(parsed == token || (errno == ERANGE && std::abs(result) > 1)) return false;
+    p = start + (parsed - token);
+    value = result;
+    return true;
+}
+
+//Upper bound of the number of lines in [first, last)
+inline std::size_t countLines(const char* first, const char* last)
+{
+    std::size_t lines = 0;
+    for(const char* p = first; p != last; ++lines)
+    {
+        const void* newline = std::memchr(p, '\n', last - p);
+        if(!newline) return lines + 1;
+        p = static_cast<const char*>(newline) + 1;
+    }
+    return lines;
+}
+
+//Parse one number per line of [first, last) into *out*, skipping blank lines
+template <typename Type>
+std::size_t parseLines(const char* text, const char* first, const char* last, Type* out)
+{
+    std::size_t parsed = 0;
+    const char* p = first;
+    while(p != last)
+    {
+        while(p != last && isBlank(*p))
+            ++p;
+        if(p == last) break;
+        if(*p == '\n')
+        {
+            ++p;
+            continue;
+        }
+        if(!parseNumber(p, last, out[parsed])) throw malformed(text, p);
+        ++parsed;
+        while(p != last && isBlank(*p))
+            ++p;
+        if(p != last && *p++ != '\n') throw malformed(text, p - 1);
+    }
+    return parsed;
+}
+
+//Read-only mapping of a whole file
+class MappedFile
+{
+    int fd;
+    const char* data;
+    std::size_t bytes;
+
+    static void fail(const char* what)
+    {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+public:
+    explicit MappedFile(const std::string& path) : fd(open(path.c_str(), O_RDONLY)), data(nullptr), bytes(0)
+    {
+        if(fd < 0) fail("open");
+        struct stat info;
+        if(fstat(fd, &info) != 0)
+        {
+            close(fd);
+            fail("fstat");
+        }
+        bytes = static_cast<std::size_t>(info.st_size);
+        if(bytes == 0) return;
+        void* mapped = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(mapped == MAP_FAILED)
+        {
+            close(fd);
+            fail("mmap");
+        }
+        data = static_cast<const char*>(mapped);
+        madvise(mapped, bytes, MADV_SEQUENTIAL);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile()
+    {
+        if(data) munmap(const_cast<char*>(data), bytes);
+        close(fd);
+    }
+
+    const char* getData() const
+    {
+        return data;
+    }
+
+    std::size_t getSize() const
+    {
+        return bytes;
+    }
+};
+
+}
+
+//Parse newline-separated numbers from *text*. The text is cut into chunks that end on line
+//boundaries; the lines of every chunk are counted in parallel, the result is sized once,
+//and every chunk is then parsed in parallel straight into its own part of the result.
+//Blank lines only cost a final in-place move of the later chunks.
+template <typename Type>
+Vector<Type> parseNumbers(const char* text, std::size_t bytes, ThreadPool& pool = ThreadPool::defaultPool())
+{
+    static_assert(std::is_arithmetic<Type>::value, "Only numbers can be parsed");
+    static_assert(!std::is_same<Type, bool>::value, "bool cannot be parsed, parse an integer type instead");
+    std::vector<const char*> bounds(1, text);
+    for(std::size_t cut = CHUNK_BYTES; cut < bytes; cut += CHUNK_BYTES)
+    {
+        if(text + cut <= bounds.back()) continue;
+        const void* newline = std::memchr(text + cut, '\n', bytes - cut);
+        if(!newline) break;
+        bounds.push_back(static_cast<const char*>(newline) + 1);
+    }
+    if(bounds.back() != text + bytes) bounds.push_back(text + bytes);
+    if(bounds.size() == 1) return Vector<Type>();
+
+    const std::size_t chunks = bounds.size() - 1;
+    std::vector<std::size_t> offsets(chunks + 1, 0);
+    parallel::detail::runRanges(bounds, [&offsets](std::size_t chunk, const char* first, const char* last)
+    {
+        offsets[chunk + 1] = detail::countLines(first, last);
+    }, pool);
+    for(std::size_t i = 0; i < chunks; ++i)
+        offsets[i + 1] += offsets[i];
+
+    Vector<Type> result;
+    result.resize(offsets[chunks]);
+    Type* out = result.data();
+    std::vector<std::size_t> parsed(chunks);
+    parallel::detail::runRanges(bounds, [text, out, &offsets, &parsed](std::size_t chunk, const char* first, const char* last)
+    {
+        parsed[chunk] = detail::parseLines(text, first, last, out + offsets[chunk]);
+    }, pool);
+
+    std::size_t size = parsed[0];
+    for(std::size_t i = 1; i < chunks; ++i)
+    {
+        if(size != offsets[i]) std::memmove(out + size, out + offsets[i], parsed[i] * sizeof(Type));
+        size += parsed[i];
+    }
+    result.resize(size);
+    return result;
+}
+
+//Load a file of newline-separated numbers through a read-only memory mapping
+template <typename Type>
+Vector<Type> loadNumbers(const std::string& path, ThreadPool& pool = ThreadPool::defaultPool())
+{
+    const detail::MappedFile file(path);
+    return parseNumbers<Type>(file.getData(), file.getSize(), pool);
+}
+
+}
+}
+
+#endif // AISDI_LINEAR_TEXTLOADER_H
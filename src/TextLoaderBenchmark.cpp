@@ -0,0 +1,73 @@
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "BenchmarkUtils.h"
+#include "TextLoader.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+
+template <typename Type>
+void perfomTest(const std::string& typeName, const std::string& path, std::size_t size, std::size_t maxThreads)
+{
+    {
+        std::ofstream file(path);
+        file << std::setprecision(17);
+        unsigned seed = 2016;
+        for(std::size_t i = 0; i < size; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+            file << static_cast<Type>(seed >> 4) / static_cast<Type>(seed % 1000 + 1) << '\n';
+        }
+    }
+    std::ifstream probe(path, std::ios::binary | std::ios::ate);
+    const double megabytes = probe.tellg() / (1024.0 * 1024.0);
+
+    std::size_t loaded = 0;
+    const double streamMs = measureMs([&]
+    {
+        aisdi::Vector<Type> values;
+        std::ifstream file(path);
+        Type value;
+        while(file >> value)
+            values.append(value);
+        loaded = values.getSize();
+    });
+
+    std::cout << "Vector<" << typeName << ">, " << size << " lines, " << std::fixed << std::setprecision(1)
+              << megabytes << " MB" << std::endl
+              << "iostream + append:     " << std::setw(8) << megabytes * 1000 / streamMs << " MB/s" << std::endl;
+    for(std::size_t threads = 1; threads <= maxThreads; ++threads)
+    {
+        aisdi::ThreadPool pool(threads);
+        const double loadMs = measureMs([&]
+        {
+            loaded = aisdi::text::loadNumbers<Type>(path, pool).getSize();
+        });
+        std::cout << "loadNumbers, " << threads << " thread(s): " << std::setw(7) << megabytes * 1000 / loadMs
+                  << " MB/s (" << loaded << " values)" << std::endl;
+    }
+    std::remove(path.c_str());
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const std::size_t size = argc > 1 ? std::atoll(argv[1]) : 10000000;
+    const std::size_t maxThreads = argc > 2 ? std::atoll(argv[2]) : aisdi::ThreadPool::defaultThreadCount();
+    const std::string path = argc > 3 ? argv[3] : "/tmp/aisdi_numbers.txt";
+
+    perfomTest<int>("int", path, size, maxThreads);
+    perfomTest<double>("double", path, size, maxThreads);
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,236 @@
+#ifndef AISDI_LINEAR_THREADPOOL_H
+#define AISDI_LINEAR_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace aisdi
+{
+
+//Small work-stealing pool. Every worker owns a deque: it pops its own tasks from the back
+//and, when idle, steals from the front of the other workers' deques.
+//A pool created for N threads starts N-1 workers, the thread waiting on a TaskGroup is the N-th.
+class ThreadPool
+{
+public:
+    using size_type = std::size_t;
+    using task_type = std::function<void()>;
+
+private:
+    struct WorkQueue
+    {
+        std::mutex mutex;
+        std::deque<task_type> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<size_type> queued; //Number of tasks waiting in all the queues
+    std::atomic<size_type> nextQueue; //Round-robin position for tasks submitted from outside
+    std::mutex sleepMutex;
+    std::condition_variable wakeUp;
+    bool stopping;
+
+    struct WorkerInfo
+    {
+        const ThreadPool* owner;
+        int index;
+    };
+
+    static WorkerInfo& currentThreadInfo()
+    {
+        static thread_local WorkerInfo info = { nullptr, -1 };
+        return info;
+    }
+
+    //Index of the calling thread's own queue or -1 when it is not a worker of this pool
+    int currentWorker() const
+    {
+        const WorkerInfo& info = currentThreadInfo();
+        return info.owner == this ? info.index : -1;
+    }
+
+public:
+    explicit ThreadPool(size_type threadCount = defaultThreadCount()) : queued(0), nextQueue(0), stopping(false)
+    {
+        if(threadCount == 0) threadCount = 1;
+        for(size_type i = 0; i < threadCount; ++i)
+            queues.emplace_back(new WorkQueue);
+        for(size_type i = 1; i < threadCount; ++i)
+            workers.emplace_back(&ThreadPool::workerLoop, this, static_cast<int>(i));
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wakeUp.notify_all();
+        for(std::thread& worker : workers)
+            worker.join();
+    }
+
+    static size_type defaultThreadCount()
+    {
+        size_type hardware = std::thread::hardware_concurrency();
+        return hardware ? hardware : 1;
+    }
+
+    //Pool shared by the parallel algorithms when no pool is given explicitly
+    static ThreadPool& defaultPool()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    size_type getThreadCount() const
+    {
+        return queues.size();
+    }
+
+    void submit(task_type task)
+    {
+        int own = currentWorker();
+        size_type target = own >= 0 ? own : nextQueue++ % queues.size();
+        //Count the task before publishing it, so that a thief cannot decrement *queued* first
+        //and wrap it around
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            ++queued;
+        }
+        {
+            std::lock_guard<std::mutex> lock(queues[target]->mutex);
+            queues[target]->tasks.push_back(std::move(task));
+        }
+        wakeUp.notify_one();
+    }
+
+    //Run one queued task on the calling thread; returns false when there was nothing to run
+    bool runPendingTask()
+    {
+        int own = currentWorker();
+        task_type task;
+        if(!takeTask(own >= 0 ? own : 0, task)) return false;
+        task();
+        return true;
+    }
+
+private:
+    bool takeTask(size_type own, task_type& task)
+    {
+        {
+            WorkQueue& queue = *queues[own];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if(!queue.tasks.empty())
+            {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+                --queued;
+                return true;
+            }
+        }
+        for(size_type i = 1; i < queues.size(); ++i)
+        {
+            WorkQueue& victim = *queues[(own + i) % queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if(!victim.tasks.empty())
+            {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                --queued;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void workerLoop(int index)
+    {
+        currentThreadInfo() = WorkerInfo{ this, index };
+        task_type task;
+        for(;;)
+        {
+            if(takeTask(index, task))
+            {
+                task();
+                task = nullptr;
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wakeUp.wait(lock, [this]{ return stopping || queued > 0; });
+            if(stopping && queued == 0) return;
+        }
+    }
+};
+
+//Set of tasks submitted to a pool that can be waited for together.
+//The waiting thread executes queued tasks instead of blocking, so groups may be nested.
+class TaskGroup
+{
+private:
+    ThreadPool& pool;
+    std::atomic<std::size_t> pending;
+    std::mutex errorMutex;
+    std::exception_ptr error;
+
+public:
+    explicit TaskGroup(ThreadPool& p) : pool(p), pending(0)
+    {}
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    ~TaskGroup()
+    {
+        while(pending > 0)
+            if(!pool.runPendingTask()) std::this_thread::yield();
+    }
+
+    template <typename Function>
+    void run(Function f)
+    {
+        ++pending;
+        pool.submit([this, f]() mutable
+        {
+            try
+            {
+                f();
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if(!error) error = std::current_exception();
+            }
+            --pending;
+        });
+    }
+
+    //Help executing tasks until every task of this group has finished, then rethrow the first failure
+    void wait()
+    {
+        while(pending > 0)
+            if(!pool.runPendingTask()) std::this_thread::yield();
+        if(error)
+        {
+            std::exception_ptr e = error;
+            error = nullptr;
+            std::rethrow_exception(e);
+        }
+    }
+};
+
+}
+
+#endif // AISDI_LINEAR_THREADPOOL_H
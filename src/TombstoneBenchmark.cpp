@@ -0,0 +1,73 @@
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "BenchmarkUtils.h"
+#include "TombstoneVector.h"
+#include "Vector.h"
+
+namespace
+{
+
+using aisdi::benchmark::measureMs;
+
+void perfomTest(std::size_t size, std::size_t erases)
+{
+    aisdi::Vector<int> vector;
+    aisdi::TombstoneVector<int> lazy;
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        vector.append(static_cast<int>(i));
+        lazy.append(static_cast<int>(i));
+    }
+
+    //One sweep that erases every *stride*-th element, as a filter pass over live data would
+    const std::size_t stride = size / erases > 0 ? size / erases : 1;
+    const double vectorMs = measureMs([&]
+    {
+        std::size_t index = 0;
+        for(std::size_t i = 0; i < size; ++i)
+        {
+            if(i % stride == 0) vector.erase(vector.begin() + index);
+            else ++index;
+        }
+    });
+    const double lazyMs = measureMs([&]
+    {
+        auto it = lazy.begin();
+        for(std::size_t i = 0; i < size; ++i)
+        {
+            auto current = it++;
+            if(i % stride == 0) lazy.erase(current);
+        }
+    });
+
+    long vectorSum = 0, lazySum = 0;
+    const double scanMs = measureMs([&] { lazy.forEach([&lazySum](int item) { lazySum += item; }); });
+    for(auto it = vector.begin(); it != vector.end(); ++it)
+        vectorSum += *it;
+    const double compactMs = measureMs([&] { lazy.compact(); });
+    const double eraseIfMs = measureMs([&] { vector.eraseIf([](int item) { return item % 7 == 0; }); });
+
+    std::cout << size << " elements, every " << stride << "th erased" << std::endl
+              << std::fixed << std::setprecision(2)
+              << "Vector::erase:          " << vectorMs << " ms" << std::endl
+              << "TombstoneVector::erase: " << lazyMs << " ms (scan " << scanMs << " ms, final compact "
+              << compactMs << " ms)" << std::endl
+              << "Vector::eraseIf:        " << eraseIfMs << " ms" << std::endl;
+    if(vectorSum != lazySum) std::cout << "Results differ!" << std::endl;
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    const std::size_t size = argc > 1 ? std::atoll(argv[1]) : 1000000;
+    const std::size_t erases = argc > 2 ? std::atoll(argv[2]) : 2000;
+
+    perfomTest(size, erases);
+
+    std::cout << "Finished!" << std::endl;
+    return 0;
+}
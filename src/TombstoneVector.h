@@ -0,0 +1,409 @@
+#ifndef AISDI_LINEAR_TOMBSTONEVECTOR_H
+#define AISDI_LINEAR_TOMBSTONEVECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+
+#include "BitOps.h"
+#include "Vector.h"
+
+namespace aisdi
+{
+
+//Vector with lazy erase: erase() only sets the element's bit in a tombstone bitmap, which
+//is O(1) instead of shifting the tail. Iteration skips erased slots a whole bitmap word at a
+//time. The slots are compacted in one pass once the erased ones exceed the compaction ratio,
+//on compact(), and by eraseIf(). Compaction invalidates iterators.
+template <typename Type>
+class TombstoneVector
+{
+public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type*;
+    using reference = Type&;
+    using const_pointer = const Type*;
+    using const_reference = const Type&;
+
+    class ConstIterator;
+    class Iterator;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+private:
+    static const size_type NONE = static_cast<size_type>(-1);
+
+    Vector<value_type> slots; //Live and erased elements in their original order
+    Vector<std::uint64_t> tombstones; //Bit i is set when slot i is erased
+    size_type erasedCount;
+    double compactionRatio; //Largest tolerated fraction of erased slots
+
+    bool isErased(size_type slot) const
+    {
+        return (tombstones.data()[slot / bits::WORD_BITS] >> (slot % bits::WORD_BITS)) & 1;
+    }
+
+    //First live slot at or after *slot*, or the slot count when there is none
+    size_type nextLive(size_type slot) const
+    {
+        const size_type count = slots.getSize();
+        const std::uint64_t* words = tombstones.data();
+        while(slot < count)
+        {
+            const size_type word = slot / bits::WORD_BITS;
+            const std::uint64_t live = ~words[word] & ~bits::lowMask(slot % bits::WORD_BITS);
+            if(live)
+            {
+                slot = word * bits::WORD_BITS + bits::countTrailingZeros(live);
+                return slot < count ? slot : count;
+            }
+            slot = (word + 1) * bits::WORD_BITS;
+        }
+        return count;
+    }
+
+    //Last live slot before *slot*, or NONE when there is none
+    size_type previousLive(size_type slot) const
+    {
+        const std::uint64_t* words = tombstones.data();
+        while(slot > 0)
+        {
+            const size_type word = (slot - 1) / bits::WORD_BITS;
+            const std::uint64_t live = ~words[word] & bits::lowMask((slot - 1) % bits::WORD_BITS + 1);
+            if(live) return word * bits::WORD_BITS + bits::WORD_BITS - 1 - bits::countLeadingZeros(live);
+            slot = word * bits::WORD_BITS;
+        }
+        return NONE;
+    }
+
+    void markErased(size_type slot)
+    {
+        tombstones.data()[slot / bits::WORD_BITS] |= std::uint64_t(1) << (slot % bits::WORD_BITS);
+        ++erasedCount;
+    }
+
+    void compactIfNeeded()
+    {
+        if(erasedCount > compactionRatio * slots.getSize()) compact();
+    }
+
+    //Move the slots for which keep(slot) is true to the front, in order, and clear the bitmap
+    template <typename Keep>
+    void compactWhere(Keep keep)
+    {
+        value_type* items = slots.data();
+        const size_type count = slots.getSize();
+        size_type kept = 0;
+        for(size_type slot = 0; slot < count; ++slot)
+        {
+            if(!keep(slot)) continue;
+            if(kept != slot) items[kept] = items[slot];
+            ++kept;
+        }
+        slots.resize(kept);
+        tombstones.resize((kept + bits::WORD_BITS - 1) / bits::WORD_BITS);
+        std::uint64_t* words = tombstones.data();
+        for(size_type i = 0; i < tombstones.getSize(); ++i)
+            words[i] = 0;
+        erasedCount = 0;
+    }
+
+public:
+    explicit TombstoneVector(double ratio = 0.25) : erasedCount(0), compactionRatio(ratio)
+    {}
+
+    TombstoneVector(std::initializer_list<Type> l) : TombstoneVector()
+    {
+        slots.reserve(l.size());
+        for(const value_type& item : l)
+            append(item);
+    }
+
+    bool isEmpty() const
+    {
+        return getSize() == 0;
+    }
+
+    //Number of live elements
+    size_type getSize() const
+    {
+        return slots.getSize() - erasedCount;
+    }
+
+    size_type getErasedCount() const
+    {
+        return erasedCount;
+    }
+
+    double getCompactionRatio() const
+    {
+        return compactionRatio;
+    }
+
+    void setCompactionRatio(double ratio)
+    {
+        compactionRatio = ratio;
+        compactIfNeeded();
+    }
+
+    void append(const Type& item)
+    {
+        if(slots.getSize() % bits::WORD_BITS == 0) tombstones.append(0);
+        slots.append(item);
+    }
+
+    //Mark the element at *possition* as erased; may compact
+    void erase(const const_iterator& possition)
+    {
+        if(possition.slot >= slots.getSize() || isErased(possition.slot))
+            throw std::out_of_range("Cannot erase element that does not exist");
+        markErased(possition.slot);
+        compactIfNeeded();
+    }
+
+    //Mark all live elements in [firstIncluded, lastExcluded) as erased; may compact
+    void erase(const const_iterator& firstIncluded, const const_iterator& lastExcluded)
+    {
+        if(isEmpty()) throw std::out_of_range("Vector is empty");
+        if(lastExcluded.slot < firstIncluded.slot || lastExcluded.slot > slots.getSize())
+            throw std::out_of_range("firstIncluded should be before lastExcluded");
+        for(size_type slot = nextLive(firstIncluded.slot); slot < lastExcluded.slot; slot = nextLive(slot + 1))
+            markErased(slot);
+        compactIfNeeded();
+    }
+
+    //Remove every live element for which pred(element) is true, together with all tombstones,
+    //in one pass; returns the number of elements removed by *pred*
+    template <typename Predicate>
+    size_type eraseIf(Predicate pred)
+    {
+        const size_type before = getSize();
+        const value_type* items = slots.data();
+        compactWhere([this, items, &pred](size_type slot) { return !isErased(slot) && !pred(items[slot]); });
+        return before - slots.getSize();
+    }
+
+    //Drop all tombstones in one pass
+    void compact()
+    {
+        if(erasedCount == 0) return;
+        compactWhere([this](size_type slot) { return !isErased(slot); });
+    }
+
+    value_type popLast()
+    {
+        if(isEmpty()) throw std::logic_error("Vector is empty");
+        //The last live element and the tombstones after it are dropped for real
+        const size_type last = previousLive(slots.getSize());
+        value_type temp = slots.data()[last];
+        erasedCount -= slots.getSize() - last - 1;
+        slots.resize(last);
+        tombstones.resize((last + bits::WORD_BITS - 1) / bits::WORD_BITS);
+        if(last % bits::WORD_BITS) tombstones.data()[last / bits::WORD_BITS] &= bits::lowMask(last % bits::WORD_BITS);
+        return temp;
+    }
+
+    //Call f(item) for every live element in order, one bitmap word at a time
+    template <typename Function>
+    void forEach(Function f) const
+    {
+        const value_type* items = slots.data();
+        const std::uint64_t* words = tombstones.data();
+        const size_type count = slots.getSize();
+        for(size_type word = 0; word < tombstones.getSize(); ++word)
+        {
+            const size_type base = word * bits::WORD_BITS;
+            const unsigned valid = count - base < bits::WORD_BITS ? count - base : bits::WORD_BITS;
+            std::uint64_t live = ~words[word] & bits::lowMask(valid);
+            if(live == bits::lowMask(valid))
+            {
+                for(unsigned i = 0; i < valid; ++i)
+                    f(items[base + i]);
+                continue;
+            }
+            for(; live; live &= live - 1)
+                f(items[base + bits::countTrailingZeros(live)]);
+        }
+    }
+
+    iterator begin()
+    {
+        return iterator(cbegin());
+    }
+
+    iterator end()
+    {
+        return iterator(cend());
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(this, nextLive(0));
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(this, slots.getSize());
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+};
+
+template <typename Type>
+const typename TombstoneVector<Type>::size_type TombstoneVector<Type>::NONE;
+
+//Points at a slot; stepping skips erased ones
+template <typename Type>
+class TombstoneVector<Type>::ConstIterator
+{
+public:
+    friend class TombstoneVector<Type>;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename TombstoneVector::value_type;
+    using difference_type = typename TombstoneVector::difference_type;
+    using pointer = typename TombstoneVector::const_pointer;
+    using reference = typename TombstoneVector::const_reference;
+
+protected:
+    const TombstoneVector<Type>* parent_vec;
+    size_type slot;
+
+public:
+    explicit ConstIterator() : parent_vec(nullptr), slot(0)
+    {}
+
+    ConstIterator(const TombstoneVector<Type>* parent, size_type s) : parent_vec(parent), slot(s)
+    {}
+
+    reference operator*() const
+    {
+        if(slot >= parent_vec->slots.getSize()) throw std::out_of_range("Iterator points at empty space after the last element");
+        return parent_vec->slots.data()[slot];
+    }
+
+    ConstIterator& operator++()
+    {
+        if(slot >= parent_vec->slots.getSize()) throw std::out_of_range("Cannot increment iterator");
+        slot = parent_vec->nextLive(slot + 1);
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    ConstIterator& operator--()
+    {
+        const size_type previous = parent_vec->previousLive(slot);
+        if(previous == NONE) throw std::out_of_range("Cannot decrement iterator");
+        slot = previous;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        ConstIterator temp = *this;
+        for(; d > 0; --d)
+            ++temp;
+        for(; d < 0; ++d)
+            --temp;
+        return temp;
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        return *this + (-d);
+    }
+
+    bool operator==(const ConstIterator& other) const
+    {
+        return parent_vec == other.parent_vec && slot == other.slot;
+    }
+
+    bool operator!=(const ConstIterator& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+template <typename Type>
+class TombstoneVector<Type>::Iterator : public TombstoneVector<Type>::ConstIterator
+{
+public:
+    using pointer = typename TombstoneVector::pointer;
+    using reference = typename TombstoneVector::reference;
+
+    explicit Iterator()
+    {}
+
+    Iterator(const ConstIterator& other) : ConstIterator(other)
+    {}
+
+    Iterator& operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator& operator--()
+    {
+        ConstIterator::operator--();
+        return *this;
+    }
+
+    Iterator operator--(int)
+    {
+        auto result = *this;
+        ConstIterator::operator--();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    Iterator operator-(difference_type d) const
+    {
+        return ConstIterator::operator-(d);
+    }
+
+    reference operator*() const
+    {
+        // ugly cast, yet reduces code duplication.
+        return const_cast<reference>(ConstIterator::operator*());
+    }
+};
+
+}
+
+#endif // AISDI_LINEAR_TOMBSTONEVECTOR_H
@@ -1,6 +1,7 @@
 #ifndef AISDI_LINEAR_VECTOR_H
 #define AISDI_LINEAR_VECTOR_H
 
+#include <algorithm>
 #include <cstddef>
 #include <initializer_list>
 #include <stdexcept>
@@ -9,6 +10,9 @@
 namespace aisdi
 {
 
+template <typename Derived>
+class VectorExpression;
+
 template <typename Type>
 class Vector
 {
@@ -75,6 +79,14 @@ public:
         return *this;
     }
 
+    //Evaluate a lazy expression (see VectorExpressions.h) into the existing storage
+    template <typename Expression>
+    Vector& operator=(const VectorExpression<Expression>& expression)
+    {
+        assign(*this, expression);
+        return *this;
+    }
+
     bool isEmpty() const
     {
         return size<=0;
@@ -90,6 +102,37 @@ public:
         return capacity;
     }
 
+    //Direct access to the contiguous storage (valid until the next reallocation)
+    pointer data()
+    {
+        return vec;
+    }
+
+    const_pointer data() const
+    {
+        return vec;
+    }
+
+    //Make sure there is space for at least *newCapacity* elements
+    void reserve(size_type newCapacity)
+    {
+        if(newCapacity<=capacity) return;
+        value_type *new_space = new value_type[newCapacity];
+        std::copy(vec, vec + size, new_space);
+        delete[] vec;
+        vec = new_space;
+        capacity = newCapacity;
+    }
+
+    //Change the number of stored elements, new ones are value-initialized
+    void resize(size_type newSize)
+    {
+        reserve(newSize);
+        for(size_type i=size; i<newSize; ++i)
+            vec[i] = value_type();
+        size = newSize;
+    }
+
     void append(const Type& item)
     {
         insert(end(), item);
@@ -173,6 +216,23 @@ public:
         size -= numErased;
     }
 
+    //Remove every element for which pred(element) is true in one pass, keeping the order
+    //of the rest; returns the number of removed elements
+    template <typename Predicate>
+    size_type eraseIf(Predicate pred)
+    {
+        size_type kept = 0;
+        for(size_type i=0; i<size; ++i)
+        {
+            if(pred(vec[i])) continue;
+            if(kept!=i) vec[kept] = vec[i];
+            ++kept;
+        }
+        const size_type removed = size - kept;
+        size = kept;
+        return removed;
+    }
+
     iterator begin()
     {
         return iterator(const_iterator(this, vec));
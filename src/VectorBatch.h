@@ -0,0 +1,184 @@
+#ifndef AISDI_LINEAR_VECTORBATCH_H
+#define AISDI_LINEAR_VECTORBATCH_H
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "Vector.h"
+
+namespace aisdi
+{
+
+//Positional inserts and erases collected for one Vector and applied together. Positions
+//mean the same as for Vector::insert and Vector::erase called in the order the operations
+//were recorded, so the result is identical to applying them one by one; but instead of
+//shifting the tail for every operation, applyTo() first works out where every original
+//element ends up and then moves each of them at most once, with at most one reallocation.
+//Planning keeps the vector as a list of runs and costs O(k^2) for k operations, which is
+//negligible next to the O(k*n) shifting it replaces for the hundreds of operations per batch
+//this is meant for.
+template <typename Type>
+class VectorBatch
+{
+public:
+    using size_type = std::size_t;
+    using value_type = Type;
+
+private:
+    struct Operation
+    {
+        bool insert;
+        size_type position;
+        size_type item; //Index in *items* for inserts
+    };
+
+    //Piece of the vector being planned: *count* original elements starting at *first*, or
+    //one inserted item with index *first* in *items*
+    struct Run
+    {
+        bool inserted;
+        size_type first;
+        size_type count;
+    };
+
+    std::vector<Operation> operations;
+    std::vector<value_type> items;
+
+    //Run holding *position*, and the position within it; runs.size() when *position* is the end
+    static size_type locate(const std::vector<Run>& runs, size_type position, size_type& offset)
+    {
+        size_type r = 0;
+        for(; r < runs.size() && position >= runs[r].count; ++r)
+            position -= runs[r].count;
+        offset = position;
+        return r;
+    }
+
+    std::vector<Run> plan(size_type size) const
+    {
+        std::vector<Run> runs;
+        if(size > 0) runs.push_back(Run{ false, 0, size });
+        for(const Operation& operation : operations)
+        {
+            size_type offset;
+            const size_type r = locate(runs, operation.position, offset);
+            if(operation.insert)
+            {
+                if(operation.position > size) throw std::out_of_range("Cannot insert outside of the vector");
+                size_type at = r;
+                if(offset > 0)
+                {
+                    const Run tail{ false, runs[r].first + offset, runs[r].count - offset };
+                    runs[r].count = offset;
+                    runs.insert(runs.begin() + r + 1, tail);
+                    at = r + 1;
+                }
+                runs.insert(runs.begin() + at, Run{ true, operation.item, 1 });
+                ++size;
+            }
+            else
+            {
+                if(operation.position >= size) throw std::out_of_range("Index out of range");
+                Run& run = runs[r];
+                if(run.count == 1) runs.erase(runs.begin() + r);
+                else if(offset == 0)
+                {
+                    ++run.first;
+                    --run.count;
+                }
+                else if(offset == run.count - 1) --run.count;
+                else
+                {
+                    const Run tail{ false, run.first + offset + 1, run.count - offset - 1 };
+                    run.count = offset;
+                    runs.insert(runs.begin() + r + 1, tail);
+                }
+                --size;
+            }
+        }
+        return runs;
+    }
+
+public:
+    bool isEmpty() const
+    {
+        return operations.empty();
+    }
+
+    //Number of recorded operations
+    size_type getSize() const
+    {
+        return operations.size();
+    }
+
+    void clear()
+    {
+        operations.clear();
+        items.clear();
+    }
+
+    //Record Vector::insert of *item* before *position*
+    void insert(size_type position, const Type& item)
+    {
+        items.push_back(item);
+        operations.push_back(Operation{ true, position, items.size() - 1 });
+    }
+
+    //Record Vector::erase of the element at *position*
+    void erase(size_type position)
+    {
+        operations.push_back(Operation{ false, position, 0 });
+    }
+
+    //Apply all recorded operations to *vector*. Positions are checked before anything is
+    //changed, so an invalid operation throws std::out_of_range and leaves *vector* untouched.
+    void applyTo(Vector<Type>& vector) const
+    {
+        if(operations.empty()) return;
+        const size_type size = vector.getSize();
+        const std::vector<Run> runs = plan(size);
+        size_type finalSize = 0;
+        for(const Run& run : runs)
+            finalSize += run.count;
+
+        if(finalSize > vector.getCapacity())
+        {
+            //One new buffer, filled run by run
+            Vector<Type> result;
+            result.resize(finalSize);
+            const value_type* source = vector.data();
+            value_type* out = result.data();
+            for(const Run& run : runs)
+            {
+                if(run.inserted) *out++ = items[run.first];
+                else out = std::copy(source + run.first, source + run.first + run.count, out);
+            }
+            swap(vector, result);
+            return;
+        }
+
+        //In place: originals moving left are moved front to back, those moving right back to
+        //front, so no run overwrites one that has not been moved yet; inserted items go last
+        if(finalSize > size) vector.resize(finalSize);
+        value_type* data = vector.data();
+        std::vector<size_type> destinations(runs.size());
+        for(size_type r = 0, at = 0; r < runs.size(); at += runs[r++].count)
+            destinations[r] = at;
+        for(size_type r = 0; r < runs.size(); ++r)
+            if(!runs[r].inserted && destinations[r] < runs[r].first)
+                std::copy(data + runs[r].first, data + runs[r].first + runs[r].count, data + destinations[r]);
+        for(size_type r = runs.size(); r-- > 0;)
+            if(!runs[r].inserted && destinations[r] > runs[r].first)
+                std::copy_backward(data + runs[r].first, data + runs[r].first + runs[r].count,
+                                   data + destinations[r] + runs[r].count);
+        for(size_type r = 0; r < runs.size(); ++r)
+            if(runs[r].inserted) data[destinations[r]] = items[runs[r].first];
+        if(finalSize < size) vector.resize(finalSize);
+    }
+};
+
+}
+
+#endif // AISDI_LINEAR_VECTORBATCH_H
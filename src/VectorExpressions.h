@@ -0,0 +1,559 @@
+#ifndef AISDI_LINEAR_VECTOREXPRESSIONS_H
+#define AISDI_LINEAR_VECTOREXPRESSIONS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "BitOps.h"
+#include "BitVector.h"
+#include "Vector.h"
+
+namespace aisdi
+{
+
+//Lazy element-wise expressions over Vectors of arithmetic types, e.g. a * x + b - c.
+//Operators only build a small tree of references; the whole tree is evaluated in a single
+//loop when it is assigned to a Vector, so no temporary Vectors are created.
+template <typename Derived>
+class VectorExpression
+{
+public:
+    const Derived& self() const
+    {
+        return static_cast<const Derived&>(*this);
+    }
+
+    template <typename Type>
+    operator Vector<Type>() const
+    {
+        Vector<Type> result;
+        assign(result, *this);
+        return result;
+    }
+
+    operator BitVector() const
+    {
+        BitVector result;
+        assign(result, *this);
+        return result;
+    }
+};
+
+//Evaluate *expression* into *destination* in one pass, reusing its storage when sizes match.
+//Assigning an expression with Vector::operator= comes here as well.
+//Element i of the result depends only on element i of the operands, so *destination*
+//may appear in the expression itself.
+template <typename Type, typename Expression>
+void assign(Vector<Type>& destination, const VectorExpression<Expression>& expression)
+{
+    const Expression& e = expression.self();
+    const std::size_t size = e.getSize();
+    if(destination.getSize() != size) destination.resize(size);
+    Type* out = destination.data();
+    for(std::size_t i = 0; i < size; ++i)
+        out[i] = e[i];
+}
+
+//Flags are packed into whole words before they are stored
+template <typename Expression>
+void assign(BitVector& destination, const VectorExpression<Expression>& expression)
+{
+    const Expression& e = expression.self();
+    const std::size_t size = e.getSize();
+    if(destination.getSize() != size) destination.resize(size);
+    BitVector::word_type* out = destination.getWords();
+    for(std::size_t first = 0; first < size; first += bits::WORD_BITS)
+    {
+        const std::size_t last = std::min<std::size_t>(first + bits::WORD_BITS, size);
+        BitVector::word_type word = 0;
+        for(std::size_t i = first; i < last; ++i)
+            word |= BitVector::word_type(e[i] ? 1 : 0) << (i - first);
+        out[first / bits::WORD_BITS] = word;
+    }
+}
+
+namespace expression
+{
+
+//Leaf referring to the storage of a Vector
+template <typename Type>
+class Terminal : public VectorExpression<Terminal<Type>>
+{
+public:
+    using value_type = Type;
+
+private:
+    const Type* values;
+    std::size_t size;
+
+public:
+    explicit Terminal(const Vector<Type>& vector) : values(vector.data()), size(vector.getSize())
+    {}
+
+    std::size_t getSize() const
+    {
+        return size;
+    }
+
+    Type operator[](std::size_t i) const
+    {
+        return values[i];
+    }
+};
+
+//Leaf reading the packed flags of a BitVector
+class BitTerminal : public VectorExpression<BitTerminal>
+{
+public:
+    using value_type = bool;
+
+private:
+    const BitVector::word_type* words;
+    std::size_t size;
+
+public:
+    explicit BitTerminal(const BitVector& vector) : words(vector.getWords()), size(vector.getSize())
+    {}
+
+    std::size_t getSize() const
+    {
+        return size;
+    }
+
+    bool operator[](std::size_t i) const
+    {
+        return (words[i / bits::WORD_BITS] >> (i % bits::WORD_BITS)) & 1;
+    }
+};
+
+//Scalar operand broadcast to every position
+template <typename Type>
+class Scalar
+{
+public:
+    using value_type = Type;
+
+private:
+    Type value;
+
+public:
+    explicit Scalar(Type v) : value(v)
+    {}
+
+    Type operator[](std::size_t) const
+    {
+        return value;
+    }
+};
+
+template <typename Operation, typename Operand>
+class Unary : public VectorExpression<Unary<Operation, Operand>>
+{
+public:
+    using value_type = decltype(Operation()(std::declval<typename Operand::value_type>()));
+
+private:
+    Operand operand;
+
+public:
+    explicit Unary(const Operand& o) : operand(o)
+    {}
+
+    std::size_t getSize() const
+    {
+        return operand.getSize();
+    }
+
+    value_type operator[](std::size_t i) const
+    {
+        return Operation()(operand[i]);
+    }
+};
+
+template <typename Operand>
+struct IsScalar : std::false_type
+{};
+
+template <typename Type>
+struct IsScalar<Scalar<Type>> : std::true_type
+{};
+
+//Size of an expression combining *left* and *right*; scalars take the size of the other operand
+template <typename Left, typename Right>
+std::size_t sizeOf(const Left& left, const Right& right, std::false_type, std::false_type)
+{
+    if(left.getSize() != right.getSize()) throw std::logic_error("Vector sizes differ");
+    return left.getSize();
+}
+
+template <typename Left, typename Right>
+std::size_t sizeOf(const Left& left, const Right&, std::false_type, std::true_type)
+{
+    return left.getSize();
+}
+
+template <typename Left, typename Right>
+std::size_t sizeOf(const Left&, const Right& right, std::true_type, std::false_type)
+{
+    return right.getSize();
+}
+
+template <typename Operation, typename Left, typename Right>
+class Binary : public VectorExpression<Binary<Operation, Left, Right>>
+{
+public:
+    using value_type = decltype(Operation()(std::declval<typename Left::value_type>(),
+                                            std::declval<typename Right::value_type>()));
+
+private:
+    Left left;
+    Right right;
+    std::size_t size;
+
+public:
+    Binary(const Left& l, const Right& r) : left(l), right(r), size(sizeOf(l, r, IsScalar<Left>(), IsScalar<Right>()))
+    {}
+
+    std::size_t getSize() const
+    {
+        return size;
+    }
+
+    value_type operator[](std::size_t i) const
+    {
+        return Operation()(left[i], right[i]);
+    }
+};
+
+//Maps everything that may appear in an expression to the class stored in the tree
+template <typename Type, typename Enable = void>
+struct Operand
+{
+    static const bool valid = false;
+    static const bool scalar = false;
+};
+
+template <typename Type>
+struct Operand<Vector<Type>, typename std::enable_if<std::is_arithmetic<Type>::value>::type>
+{
+    static const bool valid = true;
+    static const bool scalar = false;
+    using type = Terminal<Type>;
+
+    static type wrap(const Vector<Type>& vector)
+    {
+        return type(vector);
+    }
+};
+
+template <>
+struct Operand<BitVector>
+{
+    static const bool valid = true;
+    static const bool scalar = false;
+    using type = BitTerminal;
+
+    static type wrap(const BitVector& vector)
+    {
+        return type(vector);
+    }
+};
+
+template <typename Type>
+struct Operand<Type, typename std::enable_if<std::is_arithmetic<Type>::value>::type>
+{
+    static const bool valid = true;
+    static const bool scalar = true;
+    using type = Scalar<Type>;
+
+    static type wrap(Type value)
+    {
+        return type(value);
+    }
+};
+
+template <typename Type>
+struct Operand<Type, typename std::enable_if<std::is_base_of<VectorExpression<Type>, Type>::value>::type>
+{
+    static const bool valid = true;
+    static const bool scalar = false;
+    using type = Type;
+
+    static const type& wrap(const Type& expression)
+    {
+        return expression;
+    }
+};
+
+template <bool Enabled, typename Operation, typename Left, typename Right>
+struct BinaryResultIf
+{};
+
+template <typename Operation, typename Left, typename Right>
+struct BinaryResultIf<true, Operation, Left, Right>
+{
+    using type = Binary<Operation, typename Operand<Left>::type, typename Operand<Right>::type>;
+};
+
+//Result of combining *Left* and *Right* with *Operation*, defined only for valid operand pairs
+//that are not both scalars, so the operators do not hijack other types
+template <typename Operation, typename Left, typename Right>
+struct BinaryResult
+        : BinaryResultIf<Operand<Left>::valid && Operand<Right>::valid
+                         && !(Operand<Left>::scalar && Operand<Right>::scalar), Operation, Left, Right>
+{};
+
+template <typename Operation, typename Left, typename Right>
+typename BinaryResult<Operation, Left, Right>::type makeBinary(const Left& left, const Right& right)
+{
+    return typename BinaryResult<Operation, Left, Right>::type(Operand<Left>::wrap(left), Operand<Right>::wrap(right));
+}
+
+struct Negate
+{
+    template <typename Type>
+    auto operator()(Type a) const -> decltype(-a)
+    {
+        return -a;
+    }
+};
+
+struct Plus
+{
+    template <typename A, typename B>
+    auto operator()(A a, B b) const -> decltype(a + b)
+    {
+        return a + b;
+    }
+};
+
+struct Minus
+{
+    template <typename A, typename B>
+    auto operator()(A a, B b) const -> decltype(a - b)
+    {
+        return a - b;
+    }
+};
+
+struct Multiplies
+{
+    template <typename A, typename B>
+    auto operator()(A a, B b) const -> decltype(a * b)
+    {
+        return a * b;
+    }
+};
+
+struct Divides
+{
+    template <typename A, typename B>
+    auto operator()(A a, B b) const -> decltype(a / b)
+    {
+        return a / b;
+    }
+};
+
+struct Less
+{
+    template <typename A, typename B>
+    bool operator()(A a, B b) const
+    {
+        return a < b;
+    }
+};
+
+struct LessEqual
+{
+    template <typename A, typename B>
+    bool operator()(A a, B b) const
+    {
+        return a <= b;
+    }
+};
+
+struct Greater
+{
+    template <typename A, typename B>
+    bool operator()(A a, B b) const
+    {
+        return a > b;
+    }
+};
+
+struct GreaterEqual
+{
+    template <typename A, typename B>
+    bool operator()(A a, B b) const
+    {
+        return a >= b;
+    }
+};
+
+struct Equal
+{
+    template <typename A, typename B>
+    bool operator()(A a, B b) const
+    {
+        return a == b;
+    }
+};
+
+struct NotEqual
+{
+    template <typename A, typename B>
+    bool operator()(A a, B b) const
+    {
+        return a != b;
+    }
+};
+
+}
+
+template <typename Type>
+typename std::enable_if<expression::Operand<Type>::valid && !expression::Operand<Type>::scalar,
+                        expression::Unary<expression::Negate, typename expression::Operand<Type>::type>>::type
+operator-(const Type& operand)
+{
+    using Result = expression::Unary<expression::Negate, typename expression::Operand<Type>::type>;
+    return Result(expression::Operand<Type>::wrap(operand));
+}
+
+template <typename Left, typename Right>
+typename expression::BinaryResult<expression::Plus, Left, Right>::type operator+(const Left& left, const Right& right)
+{
+    return expression::makeBinary<expression::Plus>(left, right);
+}
+
+template <typename Left, typename Right>
+typename expression::BinaryResult<expression::Minus, Left, Right>::type operator-(const Left& left, const Right& right)
+{
+    return expression::makeBinary<expression::Minus>(left, right);
+}
+
+template <typename Left, typename Right>
+typename expression::BinaryResult<expression::Multiplies, Left, Right>::type operator*(const Left& left, const Right& right)
+{
+    return expression::makeBinary<expression::Multiplies>(left, right);
+}
+
+template <typename Left, typename Right>
+typename expression::BinaryResult<expression::Divides, Left, Right>::type operator/(const Left& left, const Right& right)
+{
+    return expression::makeBinary<expression::Divides>(left, right);
+}
+
+//Element-wise comparisons give expressions of bool
+template <typename Left, typename Right>
+typename expression::BinaryResult<expression::Less, Left, Right>::type operator<(const Left& left, const Right& right)
+{
+    return expression::makeBinary<expression::Less>(left, right);
+}
+
+template <typename Left, typename Right>
+typename expression::BinaryResult<expression::LessEqual, Left, Right>::type operator<=(const Left& left, const Right& right)
+{
+    return expression::makeBinary<expression::LessEqual>(left, right);
+}
+
+template <typename Left, typename Right>
+typename expression::BinaryResult<expression::Greater, Left, Right>::type operator>(const Left& left, const Right& right)
+{
+    return expression::makeBinary<expression::Greater>(left, right);
+}
+
+template <typename Left, typename Right>
+typename expression::BinaryResult<expression::GreaterEqual, Left, Right>::type operator>=(const Left& left, const Right& right)
+{
+    return expression::makeBinary<expression::GreaterEqual>(left, right);
+}
+
+//Equality is named rather than overloaded, so == keeps meaning "the same Vector"
+template <typename Left, typename Right>
+typename expression::BinaryResult<expression::Equal, Left, Right>::type equal(const Left& left, const Right& right)
+{
+    return expression::makeBinary<expression::Equal>(left, right);
+}
+
+template <typename Left, typename Right>
+typename expression::BinaryResult<expression::NotEqual, Left, Right>::type notEqual(const Left& left, const Right& right)
+{
+    return expression::makeBinary<expression::NotEqual>(left, right);
+}
+
+//Reductions evaluate the expression on the fly without storing it
+
+template <typename Expression>
+typename Expression::value_type sum(const VectorExpression<Expression>& expression)
+{
+    const Expression& e = expression.self();
+    typename Expression::value_type acc = typename Expression::value_type();
+    for(std::size_t i = 0; i < e.getSize(); ++i)
+        acc += e[i];
+    return acc;
+}
+
+template <typename Expression>
+typename Expression::value_type min(const VectorExpression<Expression>& expression)
+{
+    const Expression& e = expression.self();
+    if(e.getSize() == 0) throw std::logic_error("Vector is empty");
+    typename Expression::value_type result = e[0];
+    for(std::size_t i = 1; i < e.getSize(); ++i)
+    {
+        const typename Expression::value_type item = e[i];
+        if(item < result) result = item;
+    }
+    return result;
+}
+
+template <typename Expression>
+typename Expression::value_type max(const VectorExpression<Expression>& expression)
+{
+    const Expression& e = expression.self();
+    if(e.getSize() == 0) throw std::logic_error("Vector is empty");
+    typename Expression::value_type result = e[0];
+    for(std::size_t i = 1; i < e.getSize(); ++i)
+    {
+        const typename Expression::value_type item = e[i];
+        if(result < item) result = item;
+    }
+    return result;
+}
+
+//Number of positions where the expression is true (non-zero)
+template <typename Expression>
+std::size_t countTrue(const VectorExpression<Expression>& expression)
+{
+    const Expression& e = expression.self();
+    std::size_t found = 0;
+    for(std::size_t i = 0; i < e.getSize(); ++i)
+        found += e[i] ? 1 : 0;
+    return found;
+}
+
+template <typename Expression>
+bool any(const VectorExpression<Expression>& expression)
+{
+    const Expression& e = expression.self();
+    for(std::size_t i = 0; i < e.getSize(); ++i)
+        if(e[i]) return true;
+    return false;
+}
+
+template <typename Expression>
+bool all(const VectorExpression<Expression>& expression)
+{
+    const Expression& e = expression.self();
+    for(std::size_t i = 0; i < e.getSize(); ++i)
+        if(!e[i]) return false;
+    return true;
+}
+
+}
+
+#endif // AISDI_LINEAR_VECTOREXPRESSIONS_H
@@ -0,0 +1,101 @@
+#include <BTreeVector.h>
+#include <Vector.h>
+
+#include <initializer_list>
+#include <complex>
+#include <cstdint>
+#include <iostream>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+using TestedTypes = boost::mpl::list<std::int32_t, std::uint64_t, std::complex<std::int32_t>>;
+
+template <typename T>
+using LinearCollection = aisdi::BTreeVector<T>;
+
+using std::begin;
+using std::end;
+
+BOOST_AUTO_TEST_SUITE(BTreeVectorTests)
+
+#include "LinearCollectionTests.h"
+
+BOOST_AUTO_TEST_CASE(GivenManyAppendedItems_WhenIterating_ThenLeavesAreFollowedInOrder)
+{
+  LinearCollection<int> collection;
+  const int size = 100000;
+  for(int i = 0; i < size; ++i)
+    collection.append(i);
+
+  BOOST_CHECK_GT(collection.getHeight(), 2);
+  int expected = 0;
+  for(auto it = begin(collection); it != end(collection); ++it)
+    BOOST_REQUIRE_EQUAL(*it, expected++);
+  BOOST_CHECK_EQUAL(expected, size);
+  for(auto it = end(collection); it != begin(collection);)
+    BOOST_REQUIRE_EQUAL(*--it, --expected);
+  BOOST_CHECK_EQUAL(collection.at(size / 3), size / 3);
+  BOOST_CHECK_EQUAL(*(begin(collection) + size / 2), size / 2);
+  BOOST_CHECK_EQUAL(*(end(collection) - 1), size - 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRandomPositionalEdits_WhenComparedWithVector_ThenContentsAreEqual)
+{
+  LinearCollection<int> collection;
+  aisdi::Vector<int> expected;
+  unsigned seed = 2016;
+  for(int step = 0; step < 20000; ++step)
+  {
+    seed = seed * 1103515245u + 12345u;
+    const std::size_t position = (seed >> 8) % (expected.getSize() + 1);
+    if((seed >> 4) % 5 < 2 && position < expected.getSize())
+    {
+      collection.erase(position);
+      expected.erase(begin(expected) + position);
+    }
+    else
+    {
+      collection.insert(position, step);
+      expected.insert(begin(expected) + position, step);
+    }
+  }
+
+  BOOST_REQUIRE_EQUAL(collection.getSize(), expected.getSize());
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection), begin(expected), end(expected));
+  for(std::size_t i = 0; i < expected.getSize(); i += 97)
+    BOOST_CHECK_EQUAL(collection[i], expected.data()[i]);
+}
+
+BOOST_AUTO_TEST_CASE(GivenLargeCollection_WhenErasingEverything_ThenTreeShrinksToEmpty)
+{
+  LinearCollection<int> collection;
+  for(int i = 0; i < 50000; ++i)
+    collection.prepend(i);
+
+  while(collection.getSize() > 1)
+    collection.erase(collection.getSize() / 2);
+
+  BOOST_CHECK_EQUAL(collection.getHeight(), 1);
+  BOOST_CHECK_EQUAL(collection.popLast(), 49999);
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(collection.getHeight(), 0);
+  BOOST_CHECK_THROW(collection.at(0), std::out_of_range);
+  BOOST_CHECK_THROW(collection.erase(std::size_t(0)), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenForEachIsCalled_ThenItemsAreVisitedInOrder)
+{
+  LinearCollection<int> collection;
+  for(int i = 0; i < 1000; ++i)
+    collection.insert(collection.getSize() / 2, i);
+
+  aisdi::Vector<int> visited;
+  collection.forEach([&visited](int item) { visited.append(item); });
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(visited), end(visited), begin(collection), end(collection));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,188 @@
+#include <BitVector.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using Flags = aisdi::BitVector;
+
+namespace
+{
+
+void thenFlagsMatch(const Flags& flags, const std::vector<bool>& expected)
+{
+  BOOST_REQUIRE_EQUAL(flags.getSize(), expected.size());
+  for(std::size_t i = 0; i < expected.size(); ++i)
+    BOOST_REQUIRE_EQUAL(flags[i], expected[i]);
+}
+
+Flags makeFlags(const std::vector<bool>& items)
+{
+  Flags flags;
+  for(bool item : items)
+    flags.append(item);
+  return flags;
+}
+
+std::vector<bool> randomBits(std::size_t count, unsigned seed)
+{
+  std::vector<bool> bits(count);
+  for(std::size_t i = 0; i < count; ++i)
+  {
+    seed = seed * 1103515245u + 12345u;
+    bits[i] = (seed >> 16) % 3 == 0;
+  }
+  return bits;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(BitVectorTests)
+
+BOOST_AUTO_TEST_CASE(GivenEmptyFlags_WhenPoppingOrErasing_ThenExceptionIsThrown)
+{
+  Flags flags;
+
+  BOOST_CHECK(flags.isEmpty());
+  BOOST_CHECK_THROW(flags.popFirst(), std::logic_error);
+  BOOST_CHECK_THROW(flags.popLast(), std::logic_error);
+  BOOST_CHECK_THROW(flags.erase(flags.begin()), std::out_of_range);
+  BOOST_CHECK_THROW(*flags.begin(), std::out_of_range);
+  BOOST_CHECK_EQUAL(flags.findFirst(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(GivenFlags_WhenWritingThroughIteratorsAndIndices_ThenBitsChange)
+{
+  Flags flags = { true, false, true };
+
+  *flags.begin() = false;
+  flags[1] = true;
+  flags[2].flip();
+  flags.prepend(true);
+
+  thenFlagsMatch(flags, { true, false, true, false });
+  BOOST_CHECK_EQUAL(flags.popFirst(), true);
+  BOOST_CHECK_EQUAL(flags.popLast(), false);
+  thenFlagsMatch(flags, { false, true });
+}
+
+BOOST_AUTO_TEST_CASE(GivenThousandFlags_WhenCheckingMemory_ThenEachTakesOneBit)
+{
+  Flags flags;
+  for(int i = 0; i < 1000; ++i)
+    flags.append(i % 7 == 0);
+
+  BOOST_CHECK_EQUAL(flags.getWordCount(), 16u);
+  BOOST_CHECK_EQUAL(flags.count(), 143u);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRandomInsertsAndErases_WhenComparedWithStdVector_ThenFlagsAreTheSame)
+{
+  Flags flags;
+  std::vector<bool> expected;
+  unsigned seed = 2016;
+  for(int step = 0; step < 3000; ++step)
+  {
+    seed = seed * 1103515245u + 12345u;
+    const std::size_t position = expected.empty() ? 0 : (seed >> 8) % (expected.size() + 1);
+    if((seed >> 4) % 4 == 0 && position < expected.size())
+    {
+      const std::size_t last = std::min(expected.size(), position + (seed >> 20) % 150);
+      flags.erase(flags.begin() + position, flags.begin() + last);
+      expected.erase(expected.begin() + position, expected.begin() + last);
+    }
+    else
+    {
+      const bool item = (seed >> 12) & 1;
+      flags.insert(flags.begin() + position, item);
+      expected.insert(expected.begin() + position, item);
+    }
+  }
+  thenFlagsMatch(flags, expected);
+}
+
+BOOST_AUTO_TEST_CASE(GivenFlags_WhenErasingInvalidRange_ThenExceptionIsThrown)
+{
+  Flags flags = { true, false, true };
+
+  BOOST_CHECK_THROW(flags.erase(flags.begin() + 2, flags.begin() + 1), std::out_of_range);
+  BOOST_CHECK_THROW(flags.erase(flags.begin(), flags.begin() + 4), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSparseFlags_WhenFinding_ThenSetPositionsAreVisitedInOrder)
+{
+  Flags flags;
+  flags.resize(500);
+  const std::vector<std::size_t> set = { 3, 63, 64, 130, 499 };
+  for(std::size_t position : set)
+    flags[position] = true;
+
+  std::vector<std::size_t> found;
+  for(std::size_t i = flags.findFirst(); i != flags.getSize(); i = flags.findNext(i))
+    found.push_back(i);
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(found.begin(), found.end(), set.begin(), set.end());
+  BOOST_CHECK_EQUAL(flags.count(), set.size());
+}
+
+BOOST_AUTO_TEST_CASE(GivenTwoBitmaps_WhenCombining_ThenResultIsComputedPerFlag)
+{
+  const std::vector<bool> left = randomBits(300, 1);
+  const std::vector<bool> right = randomBits(300, 2);
+  Flags both = makeFlags(left);
+  Flags either = makeFlags(left);
+  Flags different = makeFlags(left);
+  const Flags other = makeFlags(right);
+
+  both &= other;
+  either |= other;
+  different ^= other;
+
+  for(std::size_t i = 0; i < left.size(); ++i)
+  {
+    BOOST_REQUIRE_EQUAL(both[i], left[i] && right[i]);
+    BOOST_REQUIRE_EQUAL(either[i], left[i] || right[i]);
+    BOOST_REQUIRE_EQUAL(different[i], left[i] != right[i]);
+  }
+  Flags shorter = { true };
+  BOOST_CHECK_THROW(shorter &= other, std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenBitmap_WhenShifting_ThenFlagsMoveAndVacatedOnesAreCleared)
+{
+  const std::vector<bool> bits = randomBits(200, 3);
+  for(std::size_t count : { 0u, 1u, 63u, 64u, 65u, 130u, 200u, 1000u })
+  {
+    Flags towardsEnd = makeFlags(bits);
+    Flags towardsBeginning = makeFlags(bits);
+
+    towardsEnd <<= count;
+    towardsBeginning >>= count;
+
+    for(std::size_t i = 0; i < bits.size(); ++i)
+    {
+      BOOST_REQUIRE_EQUAL(towardsEnd[i], i >= count && bits[i - count]);
+      BOOST_REQUIRE_EQUAL(towardsBeginning[i], i + count < bits.size() && bits[i + count]);
+    }
+    const std::size_t setBeforeFlip = towardsEnd.count();
+    towardsEnd.flip();
+    BOOST_REQUIRE_EQUAL(towardsEnd.count(), bits.size() - setBeforeFlip);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenFlags_WhenErasingIf_ThenOnlyTheOtherValueRemains)
+{
+  Flags flags = makeFlags(randomBits(150, 4));
+  const std::size_t ones = flags.count();
+
+  BOOST_CHECK_EQUAL(flags.eraseIf([](bool flag) { return !flag; }), 150 - ones);
+
+  BOOST_CHECK_EQUAL(flags.getSize(), ones);
+  BOOST_CHECK_EQUAL(flags.count(), ones);
+  BOOST_CHECK_EQUAL(flags.eraseIf([](bool) { return false; }), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,81 @@
+#include <BTreeVector.h>
+#include <CowVector.h>
+#include <FlatSet.h>
+#include <GapBuffer.h>
+#include <ParallelAlgorithms.h>
+#include <PersistentVector.h>
+#include <PriorityQueue.h>
+#include <Serialization.h>
+#include <SimdKernels.h>
+#include <SlotMap.h>
+#include <SoaVector.h>
+#include <Sorting.h>
+#include <TombstoneVector.h>
+#include <Vector.h>
+#include <VectorBatch.h>
+
+#include <sstream>
+#include <tuple>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+//Every container and algorithm built on Vector has to keep working for bool elements,
+//which Vector stores a byte per flag (BitVector is the packed alternative)
+
+BOOST_AUTO_TEST_SUITE(BoolElementTests)
+
+BOOST_AUTO_TEST_CASE(GivenBoolVector_WhenUsingAlgorithms_ThenTheyWorkOnBytes)
+{
+  aisdi::Vector<bool> flags = { true, false, true, false, false };
+
+  BOOST_CHECK(flags.data()[0]);
+  BOOST_CHECK_EQUAL(aisdi::parallel::count(flags, true), 2u);
+  BOOST_CHECK_EQUAL(aisdi::simd::count(flags, false), 3u);
+  BOOST_CHECK(aisdi::simd::contains(flags, true));
+
+  aisdi::sort(flags);
+  const bool sorted[] = { false, false, false, true, true };
+  BOOST_CHECK_EQUAL_COLLECTIONS(flags.begin(), flags.end(), sorted, sorted + 5);
+
+  std::stringstream stream;
+  aisdi::serialization::save(stream, flags);
+  const aisdi::Vector<bool> loaded = aisdi::serialization::loadVector<bool>(stream);
+  BOOST_CHECK_EQUAL_COLLECTIONS(loaded.begin(), loaded.end(), sorted, sorted + 5);
+
+  aisdi::VectorBatch<bool> batch;
+  batch.insert(0, true);
+  batch.applyTo(flags);
+  BOOST_CHECK_EQUAL(flags.getSize(), 6u);
+}
+
+BOOST_AUTO_TEST_CASE(GivenBoolElements_WhenUsingContainers_ThenTheyCompileAndWork)
+{
+  aisdi::SoaVector<int, bool> rows;
+  rows.append(1, true);
+  rows[0].get<1>() = false;
+  BOOST_CHECK(!rows[0].get<1>());
+
+  aisdi::TombstoneVector<bool> tombstones = { true, false, true };
+  tombstones.erase(tombstones.begin() + 1);
+  BOOST_CHECK_EQUAL(tombstones.getSize(), 2u);
+
+  aisdi::FlatSet<bool> set = { true, false, true };
+  BOOST_CHECK_EQUAL(set.getSize(), 2u);
+  BOOST_CHECK(set.contains(false));
+
+  aisdi::SlotMap<bool> slots;
+  const aisdi::SlotMap<bool>::Handle handle = slots.insert(true);
+  BOOST_CHECK(slots[handle]);
+
+  aisdi::PriorityQueue<bool> queue = { false, true, false };
+  BOOST_CHECK_EQUAL(queue.popN(3).getSize(), 3u);
+
+  aisdi::CowVector<bool> cow = { true };
+  aisdi::GapBuffer<bool> gap = { true };
+  aisdi::BTreeVector<bool> tree = { true };
+  aisdi::PersistentVector<bool> persistent = { true };
+  BOOST_CHECK(*cow.begin() && *gap.begin() && *tree.begin() && *persistent.begin());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,176 @@
+#include <CompressedVector.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using aisdi::CompressedVector;
+
+namespace
+{
+
+std::vector<std::uint64_t> sortedIds(std::size_t count, unsigned maxGap)
+{
+  std::vector<std::uint64_t> ids;
+  std::uint64_t id = 1000000000000ULL;
+  unsigned seed = 2016;
+  for(std::size_t i = 0; i < count; ++i)
+  {
+    seed = seed * 1103515245u + 12345u;
+    id += (seed >> 16) % (maxGap + 1);
+    ids.push_back(id);
+  }
+  return ids;
+}
+
+CompressedVector compress(const std::vector<std::uint64_t>& values)
+{
+  CompressedVector vector;
+  for(std::uint64_t value : values)
+    vector.append(value);
+  return vector;
+}
+
+void thenValuesMatch(const CompressedVector& vector, const std::vector<std::uint64_t>& expected)
+{
+  BOOST_REQUIRE_EQUAL(vector.getSize(), expected.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(vector.begin(), vector.end(), expected.begin(), expected.end());
+  for(std::size_t i = 0; i < expected.size(); i += 7)
+    BOOST_REQUIRE_EQUAL(vector.at(i), expected[i]);
+  const aisdi::Vector<std::uint64_t> decoded = vector.decode();
+  BOOST_CHECK_EQUAL_COLLECTIONS(decoded.begin(), decoded.end(), expected.begin(), expected.end());
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(CompressedVectorTests)
+
+BOOST_AUTO_TEST_CASE(GivenEmptyVector_WhenAccessing_ThenExceptionIsThrown)
+{
+  CompressedVector vector;
+
+  BOOST_CHECK(vector.isEmpty());
+  BOOST_CHECK(vector.begin() == vector.end());
+  BOOST_CHECK_THROW(vector.at(0), std::out_of_range);
+  BOOST_CHECK_THROW(*vector.begin(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenFewValues_WhenReading_ThenTheyComeFromTheUncompressedTail)
+{
+  CompressedVector vector = { 5, 3, 9 };
+
+  BOOST_CHECK_EQUAL(vector.getBlockCount(), 0u);
+  thenValuesMatch(vector, { 5, 3, 9 });
+  BOOST_CHECK_THROW(vector.at(3), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSortedIdsWithSmallGaps_WhenCompressing_ThenFewBitsPerValueAreUsed)
+{
+  const std::vector<std::uint64_t> ids = sortedIds(100000, 15);
+
+  const CompressedVector vector = compress(ids);
+
+  thenValuesMatch(vector, ids);
+  BOOST_CHECK_LT(vector.getCompressedBytes() * 8, ids.size() * 6);
+}
+
+BOOST_AUTO_TEST_CASE(GivenUnsortedValuesInNarrowRange_WhenCompressing_ThenFrameOfReferenceIsUsed)
+{
+  std::vector<std::uint64_t> values;
+  unsigned seed = 7;
+  for(int i = 0; i < 5000; ++i)
+  {
+    seed = seed * 1103515245u + 12345u;
+    values.push_back(0xABCDEF000000ULL + (seed >> 20));
+  }
+
+  const CompressedVector vector = compress(values);
+
+  thenValuesMatch(vector, values);
+  BOOST_CHECK_LT(vector.getCompressedBytes(), values.size() * 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenValuesOfEveryWidth_WhenCompressing_ThenAllOfThemRoundTrip)
+{
+  std::vector<std::uint64_t> values;
+  for(unsigned width = 0; width <= 64; ++width)
+  {
+    const std::uint64_t mask = width == 64 ? ~0ULL : (1ULL << width) - 1;
+    for(std::size_t i = 0; i < aisdi::compressed::BLOCK_SIZE; ++i)
+      values.push_back((i * 0x9E3779B97F4A7C15ULL) & mask);
+  }
+  for(std::size_t i = 0; i < 100; ++i)
+    values.push_back(i);
+
+  thenValuesMatch(compress(values), values);
+}
+
+BOOST_AUTO_TEST_CASE(GivenIterator_WhenWalkingBackwards_ThenValuesComeInReverseOrder)
+{
+  const std::vector<std::uint64_t> ids = sortedIds(600, 3);
+  const CompressedVector vector = compress(ids);
+
+  std::size_t i = ids.size();
+  for(auto it = vector.end(); it != vector.begin();)
+    BOOST_REQUIRE_EQUAL(*--it, ids[--i]);
+
+  std::uint64_t sum = 0, expected = 0;
+  vector.forEach([&sum](std::uint64_t id) { sum += id; });
+  for(std::uint64_t id : ids)
+    expected += id;
+  BOOST_CHECK_EQUAL(sum, expected);
+}
+
+BOOST_AUTO_TEST_CASE(GivenIterator_WhenPostIncrementingAndCopying_ThenValuesMatch)
+{
+  const std::vector<std::uint64_t> ids = sortedIds(1000, 5);
+  const CompressedVector vector = compress(ids);
+
+  std::size_t i = 0;
+  for(auto it = vector.begin(); it != vector.end();)
+    BOOST_REQUIRE_EQUAL(*it++, ids[i++]);
+
+  auto first = vector.begin();
+  BOOST_CHECK_EQUAL(*first, ids[0]);
+  auto far = first + 700;
+  BOOST_CHECK_EQUAL(*far, ids[700]);
+  BOOST_CHECK_EQUAL(*first, ids[0]);
+  far = first;
+  BOOST_CHECK_EQUAL(*(far + 300), ids[300]);
+  BOOST_CHECK_EQUAL(*far, ids[0]);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyVector_WhenMeasuring_ThenNoBytesAreCounted)
+{
+  CompressedVector vector;
+  BOOST_CHECK_EQUAL(vector.getCompressedBytes(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(GivenPackedBlocks_WhenUnpacking_ThenVectorizedAndScalarDecodeAgree)
+{
+  using namespace aisdi::compressed;
+  std::uint64_t values[BLOCK_SIZE], scalar[BLOCK_SIZE], vectorized[BLOCK_SIZE];
+  for(unsigned width = 1; width <= 64; ++width)
+  {
+    for(std::size_t i = 0; i < BLOCK_SIZE; ++i)
+      values[i] = (i * 0x9E3779B97F4A7C15ULL + width) & (width == 64 ? ~0ULL : (1ULL << width) - 1);
+    std::vector<std::uint64_t> packed(width * LANES);
+    detail::pack(values, width, packed.data());
+
+    detail::unpackScalar(packed.data(), width, 42, scalar);
+    detail::unpack(packed.data(), width, 42, vectorized);
+
+    BOOST_REQUIRE_EQUAL(scalar[BLOCK_SIZE - 1], values[BLOCK_SIZE - 1] + 42);
+    BOOST_REQUIRE_EQUAL_COLLECTIONS(scalar, scalar + BLOCK_SIZE, vectorized, vectorized + BLOCK_SIZE);
+#ifdef AISDI_SIMD_VECTOR_EXTENSIONS
+    detail::unpackKernel<16>(packed.data(), width, 42, vectorized, PER_LANE);
+    BOOST_REQUIRE_EQUAL_COLLECTIONS(scalar, scalar + BLOCK_SIZE, vectorized, vectorized + BLOCK_SIZE);
+#endif
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
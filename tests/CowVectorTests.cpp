@@ -0,0 +1,191 @@
+#include <CowVector.h>
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using CowCollection = aisdi::CowVector<int>;
+
+namespace
+{
+
+template <typename Collection>
+void thenCollectionContainsValues(const Collection& collection, std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+long sumByValue(CowCollection values)
+{
+  long sum = 0;
+  for(int item : static_cast<const CowCollection&>(values))
+    sum += item;
+  return sum;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(CowVectorTests)
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenCreated_ThenNothingIsAllocated)
+{
+  const CowCollection collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(collection.data() == nullptr);
+  BOOST_CHECK(collection.begin() == collection.end());
+  BOOST_CHECK(!collection.isShared());
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCopied_ThenBufferIsShared)
+{
+  const CowCollection collection = { 1, 2, 3 };
+
+  const CowCollection copy = collection;
+  CowCollection assigned;
+  assigned = copy;
+
+  BOOST_CHECK(collection.isShared());
+  BOOST_CHECK(copy.data() == collection.data());
+  BOOST_CHECK(static_cast<const CowCollection&>(assigned).data() == collection.data());
+  BOOST_CHECK_EQUAL(sumByValue(collection), 6);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSharedBuffer_WhenCopyIsModified_ThenOriginalIsUnchanged)
+{
+  const CowCollection collection = { 1, 2, 3 };
+  CowCollection copy = collection;
+
+  copy.append(4);
+  copy.erase(copy.cbegin());
+
+  thenCollectionContainsValues(collection, { 1, 2, 3 });
+  thenCollectionContainsValues(copy, { 2, 3, 4 });
+  BOOST_CHECK(!collection.isShared());
+  BOOST_CHECK(!copy.isShared());
+}
+
+BOOST_AUTO_TEST_CASE(GivenSharedBuffer_WhenWritingThroughMutableData_ThenBufferIsClonedFirst)
+{
+  const CowCollection collection = { 1, 2, 3 };
+  CowCollection copy = collection;
+
+  copy.mutableData()[0] = 10;
+
+  thenCollectionContainsValues(collection, { 1, 2, 3 });
+  thenCollectionContainsValues(copy, { 10, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenUnsharedBuffer_WhenModified_ThenItIsNotCloned)
+{
+  CowCollection collection = { 1, 2, 3 };
+  collection.reserve(10);
+  const int* before = collection.data();
+
+  collection.append(4);
+  collection.insert(collection.cbegin() + 1, 5);
+  BOOST_CHECK_EQUAL(collection.popLast(), 4);
+
+  BOOST_CHECK(collection.data() == before);
+  thenCollectionContainsValues(collection, { 1, 5, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonConstCollection_WhenIteratedAndCopied_ThenBufferIsStillShared)
+{
+  CowCollection collection = { 1, 2, 3 };
+  int sum = 0;
+  for(int item : collection)
+    sum += item;
+
+  const CowCollection copy = collection;
+
+  BOOST_CHECK_EQUAL(sum, 6);
+  BOOST_CHECK(collection.isShared());
+  BOOST_CHECK(copy.data() == collection.data());
+}
+
+BOOST_AUTO_TEST_CASE(GivenMutableData_WhenCollectionIsCopiedLater_ThenWritesDoNotReachTheCopy)
+{
+  CowCollection collection = { 1, 2, 3 };
+  int* items = collection.mutableData();
+
+  const CowCollection copy = collection;
+  items[0] = 10;
+  items[1] = 20;
+
+  BOOST_CHECK(!collection.isShared());
+  thenCollectionContainsValues(collection, { 10, 20, 3 });
+  thenCollectionContainsValues(copy, { 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenUnshareableBuffer_WhenReallocated_ThenCopiesShareItAgain)
+{
+  CowCollection collection = { 1, 2, 3 };
+  collection.mutableData();
+  collection.reserve(100);
+
+  const CowCollection copy = collection;
+
+  BOOST_CHECK(collection.isShared());
+  BOOST_CHECK(copy.data() == static_cast<const CowCollection&>(collection).data());
+}
+
+BOOST_AUTO_TEST_CASE(GivenSharedBuffer_WhenAppendingOwnElement_ThenCopiedValueIsAppended)
+{
+  CowCollection collection = { 7 };
+  const CowCollection copy = collection;
+
+  collection.append(*copy.begin());
+  collection.append(*collection.cbegin());
+
+  thenCollectionContainsValues(collection, { 7, 7, 7 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenResizing_ThenNewItemsAreValueInitialized)
+{
+  CowCollection collection = { 1, 2 };
+  const CowCollection copy = collection;
+
+  collection.resize(4);
+  BOOST_CHECK_EQUAL(copy.getSize(), 2u);
+  thenCollectionContainsValues(collection, { 1, 2, 0, 0 });
+  collection.resize(1);
+  thenCollectionContainsValues(collection, { 1 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenPopping_ThenExceptionIsThrown)
+{
+  CowCollection collection;
+
+  BOOST_CHECK_THROW(collection.popFirst(), std::logic_error);
+  BOOST_CHECK_THROW(collection.popLast(), std::logic_error);
+  BOOST_CHECK_THROW(collection.erase(collection.begin()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSharedBuffer_WhenCopiesAreDroppedOnManyThreads_ThenBufferOutlivesItsReaders)
+{
+  CowCollection collection;
+  for(int i = 0; i < 1000; ++i)
+    collection.append(i);
+
+  std::vector<std::thread> threads;
+  std::vector<long> sums(4);
+  for(std::size_t t = 0; t < sums.size(); ++t)
+    threads.emplace_back([&sums, t](CowCollection copy)
+    {
+      for(int round = 0; round < 100; ++round)
+        sums[t] = sumByValue(copy);
+    }, collection);
+  collection.append(1000);
+  for(std::thread& thread : threads)
+    thread.join();
+
+  for(long sum : sums)
+    BOOST_CHECK_EQUAL(sum, 999 * 1000 / 2);
+  BOOST_CHECK(!collection.isShared());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,134 @@
+#include <ExternalVector.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using ExternalCollection = aisdi::ExternalVector<std::int32_t>;
+
+namespace
+{
+
+const std::size_t BLOCK_BYTES = 64 * sizeof(std::int32_t);
+const std::size_t BUDGET = 4 * BLOCK_BYTES;
+
+std::int32_t scrambled(std::size_t i)
+{
+  return static_cast<std::int32_t>((i * 2654435761u) % 100003);
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(ExternalVectorTests)
+
+BOOST_AUTO_TEST_CASE(GivenNewCollection_WhenCreated_ThenItIsEmpty)
+{
+  const ExternalCollection collection(BUDGET, BLOCK_BYTES);
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(collection.begin() == collection.end());
+  BOOST_CHECK_EQUAL(collection.getBlockSize(), 64u);
+  BOOST_CHECK_EQUAL(collection.getCacheCapacity(), 4u);
+  BOOST_CHECK_THROW(collection[0], std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionLargerThanBudget_WhenScanning_ThenAllItemsAreReadBack)
+{
+  ExternalCollection collection(BUDGET, BLOCK_BYTES);
+  for(int i = 0; i < 10000; ++i)
+    collection.append(i);
+
+  std::int64_t sum = 0;
+  collection.forEach([&sum](std::int32_t item) { sum += item; });
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 10000u);
+  BOOST_CHECK_EQUAL(collection.getCachedBlocks(), 4u);
+  BOOST_CHECK_EQUAL(sum, 10000ll * 9999 / 2);
+  BOOST_CHECK(std::equal(collection.begin(), collection.end(), collection.begin()));
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionLargerThanBudget_WhenModifyingAtRandom_ThenChangesSurviveEviction)
+{
+  ExternalCollection collection(BUDGET, BLOCK_BYTES);
+  std::vector<std::int32_t> expected;
+  for(int i = 0; i < 5000; ++i)
+  {
+    collection.append(i);
+    expected.push_back(i);
+  }
+
+  for(std::size_t i = 0; i < 5000; i += 7)
+  {
+    collection[(i * 31) % 5000] = -1;
+    expected[(i * 31) % 5000] = -1;
+  }
+  *(collection.begin() + 4999) = 42;
+  expected[4999] = 42;
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionLargerThanBudget_WhenScanningNonConstCollection_ThenNoBlockIsWrittenBack)
+{
+  ExternalCollection collection(BUDGET, BLOCK_BYTES);
+  for(int i = 0; i < 5000; ++i)
+    collection.append(i);
+  collection.forEach([](std::int32_t) {}); //Writes back the blocks appended last
+  const std::size_t written = collection.getWrittenBlocks();
+
+  std::int64_t sum = 0;
+  for(std::int32_t item : collection)
+    sum += item;
+  for(std::size_t i = 0; i < collection.getSize(); ++i)
+    sum += collection[i];
+
+  BOOST_CHECK_EQUAL(sum, 2 * 5000ll * 4999 / 2);
+  BOOST_CHECK_EQUAL(collection.getWrittenBlocks(), written);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenPoppingLast_ThenItemsComeBackInReverseOrder)
+{
+  ExternalCollection collection(BUDGET, BLOCK_BYTES);
+  for(int i = 0; i < 1000; ++i)
+    collection.append(i);
+
+  for(int i = 999; i >= 0; --i)
+    BOOST_CHECK_EQUAL(collection.popLast(), i);
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_THROW(collection.popLast(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionFittingInBudget_WhenSorting_ThenItemsAreOrdered)
+{
+  ExternalCollection collection(BUDGET, BLOCK_BYTES);
+  for(std::size_t i = 0; i < 200; ++i)
+    collection.append(scrambled(i));
+
+  collection.sort();
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 200u);
+  BOOST_CHECK(std::is_sorted(collection.begin(), collection.end()));
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionLargerThanBudget_WhenSorting_ThenRunsAreMergedInOrder)
+{
+  ExternalCollection collection(BUDGET, BLOCK_BYTES);
+  std::vector<std::int32_t> expected;
+  for(std::size_t i = 0; i < 20000; ++i)
+  {
+    collection.append(scrambled(i));
+    expected.push_back(scrambled(i));
+  }
+  std::sort(expected.begin(), expected.end(), std::greater<std::int32_t>());
+
+  collection.sort(std::greater<std::int32_t>());
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
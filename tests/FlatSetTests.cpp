@@ -0,0 +1,166 @@
+#include <FlatSet.h>
+
+#include <iterator>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using Set = aisdi::FlatSet<int>;
+using Map = aisdi::FlatMap<int, std::string>;
+
+namespace
+{
+
+void thenSetContainsValues(const Set& set, std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(set.begin(), set.end(), expected.begin(), expected.end());
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(FlatSetTests)
+
+BOOST_AUTO_TEST_CASE(GivenUnsortedInsertsWithDuplicates_WhenIterating_ThenKeysAreSortedAndUnique)
+{
+  Set set;
+  for(int key : { 5, 1, 4, 1, 3, 5, 2 })
+    set.insert(key);
+  set.flush();
+
+  thenSetContainsValues(set, { 1, 2, 3, 4, 5 });
+  BOOST_CHECK_EQUAL(set.getSize(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSet_WhenInsertingMoreKeys_ThenTheyAreMergedWithExistingOnes)
+{
+  Set set = { 10, 30, 50 };
+
+  set.insert(40);
+  set.insert(30);
+  set.insert(0);
+  set.flush();
+
+  thenSetContainsValues(set, { 0, 10, 30, 40, 50 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenPendingInsertions_WhenLookingUpThroughConstReference_ThenExceptionIsThrown)
+{
+  Set set = { 1, 2 };
+  set.insert(3);
+  const Set& readOnly = set;
+
+  BOOST_CHECK(readOnly.hasPending());
+  BOOST_CHECK_THROW(readOnly.contains(3), std::logic_error);
+  BOOST_CHECK_THROW(readOnly.getSize(), std::logic_error);
+  BOOST_CHECK_THROW(readOnly.begin(), std::logic_error);
+  BOOST_CHECK(set.contains(3));
+  BOOST_CHECK(!readOnly.hasPending());
+  BOOST_CHECK(readOnly.contains(3));
+  BOOST_CHECK_EQUAL(readOnly.getSize(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSet_WhenLookingUpAndErasing_ThenMembershipIsReported)
+{
+  Set set = { 1, 3, 5 };
+
+  BOOST_CHECK(set.contains(3));
+  BOOST_CHECK(!set.contains(4));
+  BOOST_CHECK(set.find(4) == nullptr);
+  BOOST_CHECK_EQUAL(*set.find(5), 5);
+  BOOST_CHECK(set.erase(3));
+  BOOST_CHECK(!set.erase(3));
+  thenSetContainsValues(set, { 1, 5 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenSet_WhenQueryingRange_ThenKeysInHalfOpenIntervalAreReturned)
+{
+  Set set = { 1, 3, 5, 7, 9 };
+
+  const auto inside = set.range(3, 8);
+  const auto empty = set.range(8, 3);
+
+  BOOST_REQUIRE_EQUAL(inside.getSize(), 3);
+  BOOST_CHECK_EQUAL(inside[0], 3);
+  BOOST_CHECK_EQUAL(inside[2], 7);
+  BOOST_CHECK_EQUAL(empty.getSize(), 0);
+  BOOST_CHECK_EQUAL(set.range(0, 100).getSize(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(GivenBothLayouts_WhenSearchingLargeSets_ThenResultsMatchStdSet)
+{
+  aisdi::FlatSet<int> sorted(aisdi::SearchLayout::Sorted);
+  aisdi::FlatSet<int> eytzinger(aisdi::SearchLayout::Eytzinger);
+  std::set<int> expected;
+  unsigned seed = 2016;
+  for(int i = 0; i < 5000; ++i)
+  {
+    seed = seed * 1103515245u + 12345u;
+    const int key = static_cast<int>((seed >> 8) % 20000);
+    sorted.insert(key);
+    eytzinger.insert(key);
+    expected.insert(key);
+  }
+  BOOST_REQUIRE_EQUAL(eytzinger.getSize(), expected.size());
+
+  for(int key = -1; key <= 20001; ++key)
+  {
+    const bool present = expected.count(key) > 0;
+    BOOST_REQUIRE_EQUAL(sorted.contains(key), present);
+    BOOST_REQUIRE_EQUAL(eytzinger.contains(key), present);
+  }
+  const auto range = eytzinger.range(1000, 2000);
+  BOOST_CHECK_EQUAL(range.getSize(),
+                    static_cast<std::size_t>(std::distance(expected.lower_bound(1000), expected.lower_bound(2000))));
+
+  eytzinger.erase(*expected.begin());
+  BOOST_CHECK(!eytzinger.contains(*expected.begin()));
+  BOOST_CHECK(eytzinger.contains(*expected.rbegin()));
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenInsertingExistingKey_ThenFirstValueIsKept)
+{
+  Map map = { { 2, "two" }, { 1, "one" } };
+
+  map.insert(2, "second two");
+  map.insert(3, "three");
+  map.insert(3, "second three");
+
+  BOOST_CHECK_EQUAL(map.getSize(), 3);
+  BOOST_CHECK_EQUAL(map.at(2), "two");
+  BOOST_CHECK_EQUAL(map.at(3), "three");
+  BOOST_CHECK_EQUAL((*map.begin()).first, 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenAssigning_ThenValueIsReplacedOrAdded)
+{
+  Map map = { { 1, "one" } };
+
+  map.assign(1, "uno");
+  map.assign(2, "dos");
+  *map.find(2) += "!";
+
+  BOOST_CHECK_EQUAL(map.at(1), "uno");
+  BOOST_CHECK_EQUAL(map.at(2), "dos!");
+  BOOST_CHECK_THROW(map.at(3), std::out_of_range);
+  BOOST_CHECK(map.find(3) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenQueryingRange_ThenPairsAreReturnedInKeyOrder)
+{
+  Map map;
+  for(int key = 10; key > 0; --key)
+    map.insert(key, std::to_string(key));
+
+  const auto range = map.range(4, 7);
+
+  BOOST_REQUIRE_EQUAL(range.getSize(), 3);
+  BOOST_CHECK_EQUAL(range[0].first, 4);
+  BOOST_CHECK_EQUAL(range[2].second, "6");
+  BOOST_CHECK(map.erase(5));
+  BOOST_CHECK_EQUAL(map.range(4, 7).getSize(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
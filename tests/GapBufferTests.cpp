@@ -0,0 +1,92 @@
+#include <GapBuffer.h>
+#include <Vector.h>
+
+#include <initializer_list>
+#include <complex>
+#include <cstdint>
+#include <iostream>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+using TestedTypes = boost::mpl::list<std::int32_t, std::uint64_t, std::complex<std::int32_t>>;
+
+template <typename T>
+using LinearCollection = aisdi::GapBuffer<T>;
+
+using std::begin;
+using std::end;
+
+BOOST_AUTO_TEST_SUITE(GapBufferTests)
+
+#include "LinearCollectionTests.h"
+
+BOOST_AUTO_TEST_CASE(GivenGapAtCursor_WhenTypingAndDeleting_ThenGapStaysAtCursor)
+{
+  LinearCollection<int> collection = { 1, 2, 3, 4 };
+
+  collection.insert(begin(collection) + 2, 10);
+  collection.insert(begin(collection) + 3, 11);
+  BOOST_CHECK_EQUAL(collection.getGapPosition(), 4);
+  const std::size_t capacity = collection.getCapacity();
+  collection.erase(begin(collection) + 3);
+  collection.erase(begin(collection) + 3);
+
+  BOOST_CHECK_EQUAL(collection.getGapPosition(), 3);
+  BOOST_CHECK_EQUAL(collection.getCapacity(), capacity);
+  thenCollectionContainsValues(collection, { 1, 2, 10, 4 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenEditsAtMovingCursor_WhenComparedWithVector_ThenContentsAreEqual)
+{
+  LinearCollection<int> collection;
+  aisdi::Vector<int> expected;
+  std::size_t cursor = 0;
+  for(int step = 0; step < 2000; ++step)
+  {
+    cursor = (cursor + step * 7) % (expected.getSize() + 1);
+    if(step % 3 == 2 && cursor < expected.getSize())
+    {
+      collection.erase(begin(collection) + cursor);
+      expected.erase(begin(expected) + cursor);
+    }
+    else
+    {
+      collection.insert(begin(collection) + cursor, step);
+      expected.insert(begin(expected) + cursor, step);
+    }
+  }
+
+  BOOST_REQUIRE_EQUAL(collection.getSize(), expected.getSize());
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection), begin(expected), end(expected));
+  for(std::size_t i = 0; i < expected.getSize(); ++i)
+    BOOST_CHECK_EQUAL(collection[i], expected.data()[i]);
+  BOOST_CHECK_THROW(collection[expected.getSize()], std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenGapInTheMiddle_WhenCopyingOrIteratingWithForEach_ThenElementsKeepOrder)
+{
+  LinearCollection<int> collection = { 1, 2, 4, 5 };
+  collection.insert(begin(collection) + 2, 3);
+
+  const LinearCollection<int> copy = collection;
+  aisdi::Vector<int> visited;
+  collection.forEach([&visited](int item) { visited.append(item); });
+
+  thenCollectionContainsValues(copy, { 1, 2, 3, 4, 5 });
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(visited), end(visited), begin(collection), end(collection));
+}
+
+BOOST_AUTO_TEST_CASE(GivenItemFromTheCollection_WhenInsertingItElsewhere_ThenCopyIsInserted)
+{
+  LinearCollection<int> collection = { 1, 2, 3 };
+  collection.insert(begin(collection) + 1, 9);
+
+  collection.insert(begin(collection), *(begin(collection) + 3));
+
+  thenCollectionContainsValues(collection, { 3, 1, 9, 2, 3 });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -3,6 +3,7 @@
 #include <initializer_list>
 #include <complex>
 #include <cstdint>
+#include <iterator>
 
 #include <iostream>
 
@@ -718,6 +719,55 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingRange_ThenSizeI
   BOOST_CHECK_EQUAL(collection.getSize(), 2);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenSplitting_ThenSingleEmptyRangeIsReturned,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  auto points = collection.splitPoints(4);
+
+  BOOST_REQUIRE_EQUAL(points.size(), 2);
+  BOOST_CHECK(points.front() == collection.begin());
+  BOOST_CHECK(points.back() == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenShortCollection_WhenSplittingIntoMorePartsThanElements_ThenEveryElementIsARange,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+
+  auto points = collection.splitPoints(10);
+
+  BOOST_REQUIRE_EQUAL(points.size(), 4);
+  BOOST_CHECK_EQUAL(*points[0], 1);
+  BOOST_CHECK_EQUAL(*points[1], 2);
+  BOOST_CHECK_EQUAL(*points[2], 3);
+  BOOST_CHECK(points[3] == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenLongCollection_WhenSplitting_ThenRangesAreOrderedAndNearlyEqual,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  for(int i = 0; i < 10000; ++i)
+    collection.append(i);
+
+  auto points = collection.splitPoints(7);
+
+  BOOST_REQUIRE_EQUAL(points.size(), 8);
+  BOOST_CHECK(points.front() == collection.begin());
+  BOOST_CHECK(points.back() == collection.end());
+  for(std::size_t i = 1; i + 1 < points.size(); ++i)
+  {
+    const auto position = std::distance(collection.cbegin(), points[i]);
+    const auto expected = static_cast<decltype(position)>(i * 10000 / 7);
+    BOOST_CHECK(std::abs(position - expected) <= 10000 / 7 / 8);
+  }
+}
+
 //// ConstIterator is tested via Iterator methods.
 //// If Iterator methods are to be changed, then new ConstIterator tests are required.
 
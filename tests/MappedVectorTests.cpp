@@ -0,0 +1,182 @@
+#include <MappedVector.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include "TemporaryFile.h"
+
+using MappedCollection = aisdi::MappedVector<std::int32_t>;
+
+namespace
+{
+
+template <typename Collection>
+void thenCollectionContainsValues(const Collection& collection, std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(MappedVectorTests, TemporaryFile)
+
+BOOST_AUTO_TEST_CASE(GivenNewFile_WhenOpened_ThenCollectionIsEmpty)
+{
+  MappedCollection collection(path);
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(collection.begin() == collection.end());
+  BOOST_CHECK(!collection.isReadOnly());
+}
+
+BOOST_AUTO_TEST_CASE(GivenMappedCollection_WhenAppendingPastCapacity_ThenFileGrows)
+{
+  MappedCollection collection(path);
+
+  for(int i = 0; i < 1000; ++i)
+    collection.append(i);
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 1000u);
+  BOOST_CHECK(collection.getCapacity() >= 1000u);
+  BOOST_CHECK_EQUAL(*(collection.end() - 1), 999);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSavedCollection_WhenReopened_ThenElementsAreMappedBack)
+{
+  {
+    MappedCollection collection(path);
+    collection.append(1);
+    collection.append(2);
+    collection.prepend(0);
+    collection.sync();
+  }
+
+  MappedCollection reopened(path);
+
+  thenCollectionContainsValues(reopened, { 0, 1, 2 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenMappedCollection_WhenInsertingAndErasing_ThenElementsShift)
+{
+  MappedCollection collection(path);
+  const std::int32_t values[] = { 1, 2, 3, 4, 5 };
+  collection.append(values, 5);
+
+  collection.insert(collection.begin() + 2, 10);
+  collection.erase(collection.begin());
+  collection.erase(collection.end() - 2, collection.end());
+
+  thenCollectionContainsValues(collection, { 2, 10, 3 });
+  BOOST_CHECK_EQUAL(collection.popFirst(), 2);
+  BOOST_CHECK_EQUAL(collection.popLast(), 3);
+  thenCollectionContainsValues(collection, { 10 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenReadOnlyMapping_WhenReadingAndModifying_ThenOnlyReadsAreAllowed)
+{
+  {
+    MappedCollection collection(path);
+    collection.resize(3);
+    *collection.begin() = 7;
+  }
+
+  const MappedCollection readOnly(path, MappedCollection::OpenMode::ReadOnly);
+  MappedCollection& mutableView = const_cast<MappedCollection&>(readOnly);
+
+  BOOST_CHECK(readOnly.isReadOnly());
+  thenCollectionContainsValues(readOnly, { 7, 0, 0 });
+  BOOST_CHECK_THROW(mutableView.append(1), std::logic_error);
+  BOOST_CHECK_THROW(mutableView.erase(mutableView.begin()), std::logic_error);
+  BOOST_CHECK_THROW(mutableView.sync(), std::logic_error);
+  BOOST_CHECK_NO_THROW(readOnly.advise(MappedCollection::AccessPattern::Sequential));
+}
+
+BOOST_AUTO_TEST_CASE(GivenReadOnlyMapping_WhenWritingThroughIterator_ThenExceptionIsThrown)
+{
+  {
+    MappedCollection collection(path);
+    collection.append(7);
+  }
+
+  MappedCollection readOnly(path, MappedCollection::OpenMode::ReadOnly);
+
+  BOOST_CHECK_THROW(*readOnly.begin() = 1, std::logic_error);
+  BOOST_CHECK_THROW(readOnly.data()[0] = 1, std::logic_error);
+  BOOST_CHECK_THROW(readOnly.popFirst(), std::logic_error);
+  BOOST_CHECK_EQUAL(*readOnly.cbegin(), 7);
+}
+
+BOOST_AUTO_TEST_CASE(GivenView_WhenIterating_ThenElementsAreRead)
+{
+  {
+    MappedCollection collection(path);
+    collection.append(7);
+    collection.append(8);
+  }
+
+  aisdi::MappedVectorView<int> view(path);
+  int sum = 0;
+  for(int x : view)
+    sum += x;
+
+  BOOST_CHECK_EQUAL(sum, 15);
+  BOOST_CHECK_EQUAL(view.getSize(), 2u);
+  BOOST_CHECK(std::find(view.begin(), view.end(), 8) != view.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenMissingFile_WhenOpenedReadOnly_ThenOperationThrows)
+{
+  BOOST_CHECK_THROW(MappedCollection(path, MappedCollection::OpenMode::ReadOnly), std::system_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenFileOfOtherElementType_WhenOpened_ThenOperationThrows)
+{
+  {
+    aisdi::MappedVector<double> doubles(path);
+    doubles.append(1.0);
+  }
+
+  BOOST_CHECK_THROW(MappedCollection collection(path), std::runtime_error);
+  aisdi::MappedVector<double> doubles(path);
+  BOOST_CHECK_EQUAL(doubles.getSize(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(GivenMappedCollection_WhenInsertingOwnElement_ThenCopiedValueIsInserted)
+{
+  MappedCollection collection(path);
+  collection.append(7);
+  collection.append(8);
+
+  for(int i = 0; i < 100; ++i)
+    collection.append(*collection.cbegin());
+  collection.insert(collection.cbegin(), *(collection.cbegin() + 1));
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 103u);
+  BOOST_CHECK_EQUAL(*collection.cbegin(), 8);
+  BOOST_CHECK_EQUAL(*(collection.cbegin() + 1), 7);
+  BOOST_CHECK_EQUAL(*(collection.cbegin() + 102), 7);
+}
+
+BOOST_AUTO_TEST_CASE(GivenMappedCollection_WhenAdvising_ThenHintsAreAccepted)
+{
+  MappedCollection collection(path);
+  collection.resize(4096);
+
+  BOOST_CHECK_NO_THROW(collection.advise(MappedCollection::AccessPattern::Random));
+  BOOST_CHECK_NO_THROW(collection.advise(MappedCollection::AccessPattern::Normal));
+}
+
+BOOST_AUTO_TEST_CASE(GivenEndIterator_WhenDereferencing_ThenOperationThrows)
+{
+  MappedCollection collection(path);
+
+  BOOST_CHECK_THROW(*collection.end(), std::out_of_range);
+  BOOST_CHECK_THROW(collection.popLast(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
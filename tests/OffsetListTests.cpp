@@ -0,0 +1,193 @@
+#include <OffsetList.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include "TemporaryFile.h"
+
+using OffsetCollection = aisdi::OffsetList<std::int32_t>;
+
+namespace
+{
+
+//Overwrite the 64-bit field at *offset* of the file at *path*
+void patchFile(const std::string& path, std::uint64_t offset, std::uint64_t value)
+{
+  std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+  file.seekp(static_cast<std::streamoff>(offset));
+  file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename Collection>
+void thenCollectionContainsValues(const Collection& collection, std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(OffsetListTests, TemporaryFile)
+
+BOOST_AUTO_TEST_CASE(GivenArenaList_WhenCreated_ThenItIsEmpty)
+{
+  const OffsetCollection collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(collection.getSize(), 0u);
+  BOOST_CHECK(collection.begin() == collection.end());
+  BOOST_CHECK_THROW(*collection.end(), std::out_of_range);
+  BOOST_CHECK_THROW(--collection.begin(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenArenaList_WhenInsertingAndErasing_ThenLinksAreKept)
+{
+  OffsetCollection collection = { 1, 2, 3, 4, 5 };
+
+  collection.insert(collection.begin() + 2, 10);
+  collection.prepend(0);
+  collection.erase(collection.begin() + 1);
+  collection.erase(collection.end() - 2, collection.end());
+
+  thenCollectionContainsValues(collection, { 0, 2, 10, 3 });
+  BOOST_CHECK_EQUAL(collection.popFirst(), 0);
+  BOOST_CHECK_EQUAL(collection.popLast(), 3);
+  BOOST_CHECK_EQUAL(*--collection.end(), 10);
+  BOOST_CHECK_EQUAL(collection.getSize(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(GivenIterator_WhenRegionGrows_ThenIteratorStaysValid)
+{
+  OffsetCollection collection = { 7 };
+  const OffsetCollection::iterator it = collection.begin();
+
+  for(int i = 0; i < 10000; ++i)
+    collection.append(i);
+
+  BOOST_CHECK_EQUAL(*it, 7);
+  BOOST_CHECK_EQUAL(collection.getSize(), 10001u);
+  BOOST_CHECK_EQUAL(*(collection.end() - 1), 9999);
+}
+
+BOOST_AUTO_TEST_CASE(GivenList_WhenAppendingOwnElement_ThenCopiedValueIsAppended)
+{
+  OffsetCollection collection = { 7 };
+
+  for(int i = 0; i < 10000; ++i)
+    collection.append(*collection.begin());
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 10001u);
+  BOOST_CHECK_EQUAL(*(collection.end() - 1), 7);
+}
+
+BOOST_AUTO_TEST_CASE(GivenErasedNodes_WhenAppending_ThenTheirSpaceIsReused)
+{
+  OffsetCollection collection;
+  for(int i = 0; i < 100; ++i)
+    collection.append(i);
+  const std::size_t regionSize = collection.getRegionSize();
+
+  collection.erase(collection.begin(), collection.begin() + 50);
+  for(int i = 0; i < 50; ++i)
+    collection.prepend(i);
+
+  BOOST_CHECK_EQUAL(collection.getRegionSize(), regionSize);
+  BOOST_CHECK_EQUAL(collection.getSize(), 100u);
+}
+
+BOOST_AUTO_TEST_CASE(GivenPersistedList_WhenReopened_ThenNodesAreMappedBack)
+{
+  {
+    OffsetCollection collection(path);
+    for(int i = 0; i < 5000; ++i)
+      collection.append(i);
+    collection.erase(collection.begin() + 1, collection.end() - 2);
+    collection.prepend(-1);
+  }
+
+  OffsetCollection reopened(path);
+
+  thenCollectionContainsValues(reopened, { -1, 0, 4998, 4999 });
+  reopened.append(5000);
+  BOOST_CHECK_EQUAL(reopened.getSize(), 5u);
+}
+
+BOOST_AUTO_TEST_CASE(GivenFileOfOtherElementType_WhenOpened_ThenExceptionIsThrown)
+{
+  {
+    aisdi::OffsetList<double> doubles(path);
+    doubles.append(1.0);
+  }
+
+  BOOST_CHECK_THROW(OffsetCollection collection(path), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCorruptedHeader_WhenReopened_ThenExceptionIsThrown)
+{
+  //Header fields first, last and freeNodes are at 24, 32 and 40; nodes of 24 bytes start at 64
+  const std::uint64_t patches[][2] = { { 24, 12345 }, { 24, 1ULL << 40 }, { 32, 64 + 24 * 7 }, { 40, 1ULL << 40 } };
+  for(const auto& patch : patches)
+  {
+    {
+      OffsetCollection collection(path);
+      collection.append(1);
+      collection.append(2);
+      collection.append(3);
+    }
+    patchFile(path, patch[0], patch[1]);
+
+    BOOST_CHECK_THROW(OffsetCollection collection(path), std::runtime_error);
+    std::remove(path.c_str());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenCorruptedNodeLinks_WhenValidated_ThenFalseIsReturned)
+{
+  //Nodes of 24 bytes start at 64 with next at +8 and prev at +16
+  const std::uint64_t patches[][2] = { { 64 + 8, 1ULL << 40 }, { 64 + 2 * 24 + 8, 64 }, { 64 + 24 + 16, 64 + 2 * 24 } };
+  for(const auto& patch : patches)
+  {
+    {
+      OffsetCollection collection(path);
+      collection.append(1);
+      collection.append(2);
+      collection.append(3);
+      BOOST_CHECK(collection.validate());
+    }
+    patchFile(path, patch[0], patch[1]);
+
+    OffsetCollection collection(path);
+    BOOST_CHECK(!collection.validate());
+    std::remove(path.c_str());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenTruncatedFile_WhenReopened_ThenExceptionIsThrown)
+{
+  {
+    OffsetCollection collection(path);
+    collection.append(1);
+    collection.append(2);
+  }
+  BOOST_REQUIRE_EQUAL(truncate(path.c_str(), 64 + 24), 0);
+
+  BOOST_CHECK_THROW(OffsetCollection collection(path), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyList_WhenPopping_ThenExceptionIsThrown)
+{
+  OffsetCollection collection(path);
+
+  BOOST_CHECK_THROW(collection.popFirst(), std::logic_error);
+  BOOST_CHECK_THROW(collection.popLast(), std::logic_error);
+  BOOST_CHECK_THROW(collection.erase(collection.end()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
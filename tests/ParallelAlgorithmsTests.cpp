@@ -0,0 +1,192 @@
+#include <ParallelAlgorithms.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+BOOST_AUTO_TEST_SUITE(ParallelAlgorithmsTests)
+
+namespace
+{
+
+const std::size_t BIG_SIZE = 200000;
+
+aisdi::Vector<int> makeNumbers(std::size_t size)
+{
+  aisdi::Vector<int> numbers;
+  numbers.resize(size);
+  std::uint32_t seed = 12345;
+  for(std::size_t i = 0; i < size; ++i)
+  {
+    seed = seed * 1103515245u + 12345u;
+    numbers.data()[i] = static_cast<int>(seed >> 16) % 1000;
+  }
+  return numbers;
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyVector_WhenRunningAlgorithms_ThenNothingHappens)
+{
+  aisdi::ThreadPool pool(3);
+  aisdi::Vector<int> empty;
+
+  aisdi::parallel::forEach(empty, [](int&){ throw std::logic_error("called"); }, pool);
+  aisdi::parallel::sort(empty, pool);
+
+  BOOST_CHECK_EQUAL(aisdi::parallel::reduce(empty, 7, pool), 7);
+  BOOST_CHECK_EQUAL(aisdi::parallel::count(empty, 0, pool), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(GivenBigVector_WhenForEach_ThenEveryElementIsVisitedOnce)
+{
+  aisdi::ThreadPool pool(4);
+  aisdi::Vector<int> numbers;
+  numbers.resize(BIG_SIZE);
+
+  aisdi::parallel::forEach(numbers, [](int& item){ ++item; }, pool);
+
+  BOOST_CHECK(std::all_of(numbers.data(), numbers.data() + BIG_SIZE, [](int item){ return item == 1; }));
+}
+
+BOOST_AUTO_TEST_CASE(GivenBigVector_WhenTransforming_ThenDestinationHoldsResults)
+{
+  aisdi::ThreadPool pool(4);
+  const aisdi::Vector<int> numbers = makeNumbers(BIG_SIZE);
+  aisdi::Vector<double> halves = { 1.0 };
+
+  aisdi::parallel::transform(numbers, halves, [](int item){ return item / 2.0; }, pool);
+
+  BOOST_REQUIRE_EQUAL(halves.getSize(), BIG_SIZE);
+  for(std::size_t i = 0; i < BIG_SIZE; ++i)
+    BOOST_REQUIRE_EQUAL(halves.data()[i], numbers.data()[i] / 2.0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenBigVector_WhenReducing_ThenResultMatchesSequentialSum)
+{
+  aisdi::ThreadPool pool(4);
+  const aisdi::Vector<int> numbers = makeNumbers(BIG_SIZE);
+
+  long long expected = 0;
+  for(int item : numbers)
+    expected += item;
+
+  BOOST_CHECK_EQUAL(aisdi::parallel::reduce(numbers, 0, pool), expected);
+}
+
+BOOST_AUTO_TEST_CASE(GivenDoubles_WhenReducingWithDifferentThreadCounts_ThenResultsAreIdentical)
+{
+  aisdi::Vector<double> values;
+  values.resize(BIG_SIZE);
+  for(std::size_t i = 0; i < BIG_SIZE; ++i)
+    values.data()[i] = 1.0 / (i + 1);
+
+  aisdi::ThreadPool single(1);
+  const double expected = aisdi::parallel::reduce(values, 0.0, single);
+  for(std::size_t threads = 2; threads <= 5; ++threads)
+  {
+    aisdi::ThreadPool pool(threads);
+    BOOST_CHECK_EQUAL(aisdi::parallel::reduce(values, 0.0, pool), expected);
+    BOOST_CHECK_EQUAL(aisdi::parallel::reduce(values, 0.0, pool), expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenBigVector_WhenCounting_ThenResultMatchesStdCount)
+{
+  aisdi::ThreadPool pool(3);
+  const aisdi::Vector<int> numbers = makeNumbers(BIG_SIZE);
+
+  BOOST_CHECK_EQUAL(aisdi::parallel::count(numbers, 42, pool),
+                    static_cast<std::size_t>(std::count(numbers.data(), numbers.data() + BIG_SIZE, 42)));
+  BOOST_CHECK_EQUAL(aisdi::parallel::countIf(numbers, [](int item){ return item < 500; }, pool),
+                    static_cast<std::size_t>(std::count_if(numbers.data(), numbers.data() + BIG_SIZE,
+                                                           [](int item){ return item < 500; })));
+}
+
+BOOST_AUTO_TEST_CASE(GivenBigVector_WhenSorting_ThenItIsOrdered)
+{
+  aisdi::ThreadPool pool(4);
+  aisdi::Vector<int> numbers = makeNumbers(BIG_SIZE);
+  std::vector<int> expected(numbers.data(), numbers.data() + BIG_SIZE);
+  std::sort(expected.begin(), expected.end());
+
+  aisdi::parallel::sort(numbers, pool);
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(numbers.begin(), numbers.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenEqualKeys_WhenSortingWithComparator_ThenOriginalOrderIsKept)
+{
+  aisdi::ThreadPool pool(4);
+  aisdi::Vector<int> keys = makeNumbers(BIG_SIZE);
+  aisdi::Vector<std::pair<int, std::size_t>> pairs;
+  pairs.resize(BIG_SIZE);
+  for(std::size_t i = 0; i < BIG_SIZE; ++i)
+    pairs.data()[i] = std::make_pair(keys.data()[i] % 16, i);
+
+  aisdi::parallel::sort(pairs, [](const std::pair<int, std::size_t>& a, const std::pair<int, std::size_t>& b)
+                        { return a.first < b.first; }, pool);
+
+  for(std::size_t i = 1; i < BIG_SIZE; ++i)
+  {
+    const std::pair<int, std::size_t>& previous = pairs.data()[i - 1];
+    const std::pair<int, std::size_t>& current = pairs.data()[i];
+    BOOST_REQUIRE(previous.first < current.first
+                  || (previous.first == current.first && previous.second < current.second));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenThrowingFunction_WhenForEach_ThenExceptionReachesCaller)
+{
+  aisdi::ThreadPool pool(4);
+  aisdi::Vector<int> numbers = makeNumbers(BIG_SIZE);
+
+  BOOST_CHECK_THROW(aisdi::parallel::forEach(numbers, [](int& item)
+                    {
+                      if(item == 999) throw std::runtime_error("found");
+                    }, pool), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenBigList_WhenForEach_ThenEveryElementIsVisitedOnce)
+{
+  aisdi::ThreadPool pool(4);
+  aisdi::LinkedList<int> list;
+  for(std::size_t i = 0; i < BIG_SIZE / 10; ++i)
+    list.append(0);
+
+  aisdi::parallel::forEach(list, [](int& item){ ++item; }, pool);
+
+  BOOST_CHECK(std::all_of(list.begin(), list.end(), [](int item){ return item == 1; }));
+}
+
+BOOST_AUTO_TEST_CASE(GivenBigList_WhenReducingAndCounting_ThenResultsMatchSequentialOnes)
+{
+  aisdi::ThreadPool pool(3);
+  const aisdi::Vector<int> numbers = makeNumbers(BIG_SIZE / 10);
+  aisdi::LinkedList<int> list;
+  long long expected = 0;
+  for(int item : numbers)
+  {
+    list.append(item);
+    expected += item;
+  }
+
+  BOOST_CHECK_EQUAL(aisdi::parallel::reduce(list, 0, pool), expected);
+  BOOST_CHECK_EQUAL(aisdi::parallel::count(list, 7, pool),
+                    static_cast<std::size_t>(std::count(list.begin(), list.end(), 7)));
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyList_WhenReducing_ThenInitIsReturned)
+{
+  aisdi::ThreadPool pool(2);
+  const aisdi::LinkedList<double> list;
+
+  BOOST_CHECK_EQUAL(aisdi::parallel::reduce(list, 1.5, pool), 1.5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
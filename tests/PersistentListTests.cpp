@@ -0,0 +1,168 @@
+#include <PersistentList.h>
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using PersistentCollection = aisdi::PersistentList<int>;
+
+namespace
+{
+
+template <typename Collection>
+void thenCollectionContainsValues(const Collection& collection, std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(PersistentListTests)
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenCreated_ThenItIsEmpty)
+{
+  const PersistentCollection collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(collection.getSize(), 0);
+  BOOST_CHECK(collection.begin() == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenGettingFirstOrRest_ThenExceptionIsThrown)
+{
+  const PersistentCollection collection;
+
+  BOOST_CHECK_THROW(collection.getFirst(), std::logic_error);
+  BOOST_CHECK_THROW(collection.getRest(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenInitializerList_WhenCreatingCollection_ThenItemsKeepTheirOrder)
+{
+  const PersistentCollection collection = { 1, 2, 3 };
+
+  thenCollectionContainsValues(collection, { 1, 2, 3 });
+  BOOST_CHECK_EQUAL(collection.getSize(), 3);
+  BOOST_CHECK_EQUAL(collection.getFirst(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenPrepending_ThenOriginalIsUnchangedAndTailIsShared)
+{
+  const PersistentCollection history = { 2, 3 };
+
+  const PersistentCollection left = history.prepend(1);
+  const PersistentCollection right = history.prepend(10);
+
+  thenCollectionContainsValues(history, { 2, 3 });
+  thenCollectionContainsValues(left, { 1, 2, 3 });
+  thenCollectionContainsValues(right, { 10, 2, 3 });
+  BOOST_CHECK(history.isSuffixOf(left));
+  BOOST_CHECK(history.isSuffixOf(right));
+  BOOST_CHECK(!left.isSuffixOf(right));
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenGettingRest_ThenNodesAreShared)
+{
+  const PersistentCollection collection = { 1, 2, 3 };
+
+  const PersistentCollection rest = collection.getRest();
+
+  thenCollectionContainsValues(rest, { 2, 3 });
+  BOOST_CHECK(rest.isSuffixOf(collection));
+  BOOST_CHECK(collection.drop(1).isSuffixOf(rest));
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenDroppingTooMuch_ThenExceptionIsThrown)
+{
+  const PersistentCollection collection = { 1, 2, 3 };
+
+  BOOST_CHECK(collection.drop(3).isEmpty());
+  BOOST_CHECK_THROW(collection.drop(4), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenForkedHistory_WhenOriginalIsDestroyed_ThenForksStayValid)
+{
+  PersistentCollection fork;
+  {
+    const PersistentCollection history = PersistentCollection({ 2, 3 }).prepend(1);
+    fork = history.getRest().prepend(20);
+  }
+
+  thenCollectionContainsValues(fork, { 20, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollections_WhenConcatenating_ThenSecondOneBecomesSharedTail)
+{
+  const PersistentCollection first = { 1, 2 };
+  const PersistentCollection second = { 3, 4 };
+
+  const PersistentCollection result = first.concat(second);
+
+  thenCollectionContainsValues(result, { 1, 2, 3, 4 });
+  BOOST_CHECK(second.isSuffixOf(result));
+  thenCollectionContainsValues(first, { 1, 2 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenReversing_ThenNewCollectionHasOppositeOrder)
+{
+  const PersistentCollection collection = { 1, 2, 3 };
+
+  thenCollectionContainsValues(collection.reverse(), { 3, 2, 1 });
+  thenCollectionContainsValues(collection, { 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenEndIterator_WhenDereferencingOrIncrementing_ThenExceptionIsThrown)
+{
+  const PersistentCollection collection = { 1 };
+  auto it = collection.begin();
+
+  BOOST_CHECK_EQUAL(*it++, 1);
+  BOOST_CHECK(it == collection.end());
+  BOOST_CHECK_THROW(*it, std::out_of_range);
+  BOOST_CHECK_THROW(++it, std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenVeryLongChain_WhenDestroyed_ThenStackDoesNotOverflow)
+{
+  const std::size_t size = 2000000;
+  PersistentCollection collection;
+  for(std::size_t i = 0; i < size; ++i)
+    collection = collection.prepend(static_cast<int>(i));
+  BOOST_CHECK_EQUAL(collection.getSize(), size);
+
+  collection = PersistentCollection();
+
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenSharedHistory_WhenForkedFromManyThreads_ThenEveryForkIsComplete)
+{
+  PersistentCollection history;
+  for(int i = 0; i < 1000; ++i)
+    history = history.prepend(i);
+
+  std::vector<std::thread> threads;
+  std::vector<long> sums(4, 0);
+  for(std::size_t t = 0; t < sums.size(); ++t)
+    threads.emplace_back([&history, &sums, t]
+    {
+      for(int round = 0; round < 100; ++round)
+      {
+        PersistentCollection fork = history.prepend(static_cast<int>(t));
+        fork = fork.getRest().getRest();
+        long sum = 0;
+        fork.forEach([&sum](int item) { sum += item; });
+        sums[t] = sum;
+      }
+    });
+  for(auto& thread : threads)
+    thread.join();
+
+  for(long sum : sums)
+    BOOST_CHECK_EQUAL(sum, 998L * 999 / 2);
+  BOOST_CHECK_EQUAL(history.getSize(), 1000);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
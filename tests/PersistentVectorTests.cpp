@@ -0,0 +1,156 @@
+#include <PersistentVector.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using PersistentCollection = aisdi::PersistentVector<int>;
+
+namespace
+{
+
+template <typename Collection>
+void thenCollectionContainsValues(const Collection& collection, std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+PersistentCollection makeRange(int first, int last)
+{
+  PersistentCollection::Transient batch = PersistentCollection().transient();
+  for(int i = first; i < last; ++i)
+    batch.append(i);
+  return batch.persistent();
+}
+
+void thenCollectionHoldsRange(const PersistentCollection& collection, int first, int last)
+{
+  BOOST_REQUIRE_EQUAL(collection.getSize(), static_cast<std::size_t>(last - first));
+  bool indexed = true, iterated = true;
+  for(int i = first; i < last; ++i)
+    indexed = indexed && collection[i - first] == i;
+  int expected = first;
+  for(int item : collection)
+    iterated = iterated && item == expected++;
+  BOOST_CHECK(indexed);
+  BOOST_CHECK(iterated);
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(PersistentVectorTests)
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenCreated_ThenItIsEmpty)
+{
+  const PersistentCollection collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(collection.begin() == collection.end());
+  BOOST_CHECK_THROW(collection[0], std::out_of_range);
+  BOOST_CHECK_THROW(*collection.end(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenAppending_ThenOldVersionIsUnchanged)
+{
+  const PersistentCollection first = { 1, 2, 3 };
+
+  const PersistentCollection second = first.append(4);
+
+  thenCollectionContainsValues(first, { 1, 2, 3 });
+  thenCollectionContainsValues(second, { 1, 2, 3, 4 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenAppendingManyItems_ThenTreeGrowsInHeight)
+{
+  PersistentCollection collection;
+  for(int i = 0; i < 40000; ++i)
+    collection = collection.append(i);
+
+  BOOST_CHECK_EQUAL(collection.getHeight(), 3u);
+  thenCollectionHoldsRange(collection, 0, 40000);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenSettingItem_ThenOnlyNewVersionChanges)
+{
+  const PersistentCollection original = makeRange(0, 5000);
+
+  const PersistentCollection updated = original.set(1234, -1);
+
+  BOOST_CHECK_EQUAL(original[1234], 1234);
+  BOOST_CHECK_EQUAL(updated[1234], -1);
+  BOOST_CHECK_EQUAL(updated[1233], 1233);
+  BOOST_CHECK_THROW(original.set(5000, 0), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNewVersion_WhenCountingMemory_ThenOnlyThePathIsCopied)
+{
+  const PersistentCollection original = makeRange(0, 32 * 32 * 32);
+  const std::ptrdiff_t before = PersistentCollection::getAllocatedBytes();
+
+  const PersistentCollection updated = original.set(100, 0);
+
+  const std::ptrdiff_t perVersion = PersistentCollection::getAllocatedBytes() - before;
+  BOOST_CHECK(perVersion > 0);
+  BOOST_CHECK(perVersion < static_cast<std::ptrdiff_t>(32 * 32 * sizeof(int)));
+}
+
+BOOST_AUTO_TEST_CASE(GivenTwoCollections_WhenConcatenating_ThenItemsFollowEachOther)
+{
+  const int sizes[] = { 1, 31, 32, 33, 1000, 1024, 1025, 40000 };
+  for(int left : sizes)
+    for(int right : sizes)
+    {
+      const PersistentCollection a = makeRange(0, left);
+      const PersistentCollection b = makeRange(left, left + right);
+
+      const PersistentCollection joined = a.concat(b);
+
+      thenCollectionHoldsRange(joined, 0, left + right);
+      thenCollectionHoldsRange(a, 0, left);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(GivenRelaxedTree_WhenAppendingAndSetting_ThenIndexingStaysCorrect)
+{
+  PersistentCollection collection = makeRange(0, 33);
+  for(int i = 1; i < 200; ++i)
+    collection = collection.concat(makeRange(33 * i, 33 * (i + 1)));
+  for(int i = 33 * 200; i < 33 * 200 + 100; ++i)
+    collection = collection.append(i);
+
+  thenCollectionHoldsRange(collection, 0, 33 * 200 + 100);
+  const PersistentCollection updated = collection.set(4000, -4);
+  BOOST_CHECK_EQUAL(updated[4000], -4);
+  BOOST_CHECK_EQUAL(updated[4001], 4001);
+}
+
+BOOST_AUTO_TEST_CASE(GivenTransient_WhenFrozenAndEditedAgain_ThenFrozenVersionIsUnchanged)
+{
+  PersistentCollection::Transient batch = PersistentCollection({ 1, 2 }).transient();
+  batch.append(3);
+  const PersistentCollection frozen = batch.persistent();
+
+  batch.set(0, 10);
+  batch.append(4);
+
+  thenCollectionContainsValues(frozen, { 1, 2, 3 });
+  thenCollectionContainsValues(batch.persistent(), { 10, 2, 3, 4 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenAllVersionsDropped_WhenCountingMemory_ThenAllNodesAreFreed)
+{
+  const std::ptrdiff_t before = PersistentCollection::getAllocatedBytes();
+  {
+    std::vector<PersistentCollection> versions(1, makeRange(0, 3000));
+    for(int i = 0; i < 100; ++i)
+      versions.push_back(versions.back().set(i * 7, i).append(i));
+    versions.push_back(versions[3].concat(versions[50]));
+  }
+
+  BOOST_CHECK_EQUAL(PersistentCollection::getAllocatedBytes(), before);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,188 @@
+#include <PriorityQueue.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using Queue = aisdi::PriorityQueue<int>;
+
+BOOST_AUTO_TEST_SUITE(PriorityQueueTests)
+
+BOOST_AUTO_TEST_CASE(GivenEmptyQueue_WhenPoppingOrPeeking_ThenExceptionIsThrown)
+{
+  Queue queue;
+
+  BOOST_CHECK(queue.isEmpty());
+  BOOST_CHECK_THROW(queue.top(), std::logic_error);
+  BOOST_CHECK_THROW(queue.pop(), std::logic_error);
+  BOOST_CHECK_EQUAL(queue.popN(3).getSize(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenPushedItems_WhenPopping_ThenTheyComeOutInPriorityOrder)
+{
+  Queue queue;
+  for(int item : { 5, 3, 8, 1, 9, 2, 7 })
+    queue.push(item);
+
+  BOOST_CHECK_EQUAL(queue.top(), 1);
+  BOOST_CHECK_EQUAL(queue.getSize(), 7);
+  const aisdi::Vector<int> first = queue.popN(3);
+  BOOST_CHECK_EQUAL(queue.pop(), 5);
+  BOOST_CHECK_EQUAL(queue.getSize(), 3);
+
+  const std::vector<int> expected = { 1, 2, 3 };
+  BOOST_CHECK_EQUAL_COLLECTIONS(first.begin(), first.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenQueue_WhenPushingItsTop_ThenCopiedValueIsPushed)
+{
+  Queue queue = { 3 };
+
+  for(int i = 0; i < 100; ++i)
+    queue.push(queue.top());
+
+  BOOST_CHECK_EQUAL(queue.getSize(), 101);
+  for(int i = 0; i < 101; ++i)
+    BOOST_REQUIRE_EQUAL(queue.pop(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenGreaterComparator_WhenPopping_ThenLargestComesFirst)
+{
+  aisdi::PriorityQueue<int, std::greater<int>, 8> queue = { 4, 10, 1, 7 };
+
+  BOOST_CHECK_EQUAL(queue.pop(), 10);
+  BOOST_CHECK_EQUAL(queue.pop(), 7);
+}
+
+BOOST_AUTO_TEST_CASE(GivenHandle_WhenDecreasingKey_ThenItemMovesToTheTop)
+{
+  Queue queue;
+  queue.push(10);
+  const Queue::Handle handle = queue.push(50);
+  queue.push(20);
+
+  queue.update(handle, 5);
+
+  BOOST_CHECK_EQUAL(queue.get(handle), 5);
+  BOOST_CHECK_EQUAL(queue.pop(), 5);
+  BOOST_CHECK(!queue.contains(handle));
+  BOOST_CHECK_THROW(queue.update(handle, 1), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenHandle_WhenIncreasingKeyOrErasing_ThenOrderIsKept)
+{
+  Queue queue;
+  const Queue::Handle low = queue.push(1);
+  const Queue::Handle middle = queue.push(2);
+  queue.push(3);
+
+  queue.update(low, 100);
+  queue.erase(middle);
+
+  BOOST_CHECK_EQUAL(queue.pop(), 3);
+  BOOST_CHECK_EQUAL(queue.pop(), 100);
+  BOOST_CHECK(queue.isEmpty());
+  BOOST_CHECK_THROW(queue.erase(middle), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenValues_WhenHeapifying_ThenHandlesFollowInputOrder)
+{
+  aisdi::Vector<int> values = { 9, 4, 7, 1, 8 };
+  Queue queue;
+
+  queue.heapify(values);
+  queue.update(queue.handleOf(0), 0);
+
+  BOOST_CHECK_EQUAL(queue.get(queue.handleOf(2)), 7);
+  BOOST_CHECK_EQUAL(queue.pop(), 0);
+  BOOST_CHECK_EQUAL(queue.pop(), 1);
+  BOOST_CHECK_EQUAL(queue.pop(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(GivenHandleOfPoppedItem_WhenItsIdIsReused_ThenOldHandleIsRejected)
+{
+  Queue queue;
+  const Queue::Handle popped = queue.push(1);
+  queue.pop();
+  const Queue::Handle pushed = queue.push(2);
+
+  BOOST_CHECK_EQUAL(pushed.id, popped.id);
+  BOOST_CHECK(popped != pushed);
+  BOOST_CHECK(!queue.contains(popped));
+  BOOST_CHECK(queue.contains(pushed));
+  BOOST_CHECK_THROW(queue.get(popped), std::out_of_range);
+  BOOST_CHECK_THROW(queue.update(popped, 0), std::out_of_range);
+  BOOST_CHECK_THROW(queue.erase(popped), std::out_of_range);
+  BOOST_CHECK_EQUAL(queue.top(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenHandles_WhenHeapifyingAgain_ThenOldHandlesAreRejected)
+{
+  Queue queue;
+  const Queue::Handle old = queue.push(5);
+  aisdi::Vector<int> values = { 3, 4 };
+
+  queue.heapify(values);
+
+  BOOST_CHECK(!queue.contains(old));
+  BOOST_CHECK(queue.contains(queue.handleOf(0)));
+  BOOST_CHECK_EQUAL(queue.get(queue.handleOf(1)), 4);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRandomOperations_WhenComparedWithStdPriorityQueue_ThenSameItemsArePopped)
+{
+  aisdi::PriorityQueue<int, std::less<int>, 3> queue;
+  std::priority_queue<int, std::vector<int>, std::greater<int>> expected;
+  unsigned seed = 2016;
+  for(int step = 0; step < 20000; ++step)
+  {
+    seed = seed * 1103515245u + 12345u;
+    if((seed >> 8) % 3 == 0 && !expected.empty())
+    {
+      BOOST_REQUIRE_EQUAL(queue.pop(), expected.top());
+      expected.pop();
+    }
+    else
+    {
+      const int item = static_cast<int>((seed >> 12) % 1000);
+      queue.push(item);
+      expected.push(item);
+    }
+  }
+  BOOST_REQUIRE_EQUAL(queue.getSize(), expected.size());
+  while(!expected.empty())
+  {
+    BOOST_REQUIRE_EQUAL(queue.pop(), expected.top());
+    expected.pop();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenManyHandles_WhenUpdatingRandomly_ThenPopsAreSorted)
+{
+  Queue queue;
+  std::vector<Queue::Handle> handles;
+  for(int i = 0; i < 2000; ++i)
+    handles.push_back(queue.push(i));
+
+  unsigned seed = 7;
+  for(int step = 0; step < 5000; ++step)
+  {
+    seed = seed * 1103515245u + 12345u;
+    queue.update(handles[(seed >> 8) % handles.size()], static_cast<int>((seed >> 4) % 100000));
+  }
+
+  int previous = queue.pop();
+  while(!queue.isEmpty())
+  {
+    const int current = queue.pop();
+    BOOST_REQUIRE_LE(previous, current);
+    previous = current;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,197 @@
+#include <Serialization.h>
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace serialization = aisdi::serialization;
+
+namespace
+{
+
+template <typename Collection>
+void thenCollectionContainsValues(const Collection& collection, std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+template <typename Collection>
+std::string saved(const Collection& collection)
+{
+  std::ostringstream out;
+  serialization::save(out, collection);
+  return out.str();
+}
+
+//Stream over a string that cannot seek, like a pipe or a socket
+class ForwardOnlyBuffer : public std::streambuf
+{
+  std::string data;
+
+public:
+  explicit ForwardOnlyBuffer(const std::string& d) : data(d)
+  {
+    setg(&data[0], &data[0], &data[0] + data.size());
+  }
+};
+
+std::string withCount(std::string data, std::uint64_t count)
+{
+  std::memcpy(&data[24], &count, sizeof(count));
+  return data;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(SerializationTests)
+
+BOOST_AUTO_TEST_CASE(GivenVector_WhenSavedAndLoaded_ThenLoadedVectorHasSameItems)
+{
+  const aisdi::Vector<int> vector = { 1, 2, 3, 4, 5 };
+  std::istringstream in(saved(vector));
+
+  thenCollectionContainsValues(serialization::loadVector<int>(in), { 1, 2, 3, 4, 5 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenVector_WhenSaved_ThenHeaderIsFollowedByPayload)
+{
+  const aisdi::Vector<std::int32_t> vector = { 7, 8, 9 };
+
+  BOOST_CHECK_EQUAL(saved(vector).size(), serialization::HEADER_SIZE + 3 * sizeof(std::int32_t));
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyVector_WhenSavedAndLoaded_ThenLoadedVectorIsEmpty)
+{
+  std::istringstream in(saved(aisdi::Vector<double>()));
+
+  BOOST_CHECK(serialization::loadVector<double>(in).isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenLinkedList_WhenSavedAndLoaded_ThenLoadedListHasSameItems)
+{
+  const aisdi::LinkedList<int> list = { 3, 1, 4, 1, 5 };
+  std::istringstream in(saved(list));
+
+  thenCollectionContainsValues(serialization::loadList<int>(in), { 3, 1, 4, 1, 5 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenLongLinkedList_WhenSavedAndLoaded_ThenAllBlocksAreRestored)
+{
+  aisdi::LinkedList<int> list;
+  aisdi::Vector<int> vector;
+  for(int i = 0; i < 10000; ++i)
+  {
+    list.append(i);
+    vector.append(i);
+  }
+  const std::string listData = saved(list);
+  std::istringstream in(listData);
+
+  const aisdi::LinkedList<int> loaded = serialization::loadList<int>(in);
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(loaded.begin(), loaded.end(), list.begin(), list.end());
+  BOOST_CHECK(listData.substr(serialization::HEADER_SIZE) == saved(vector).substr(serialization::HEADER_SIZE));
+}
+
+BOOST_AUTO_TEST_CASE(GivenCorruptedPayload_WhenLoading_ThenExceptionIsThrown)
+{
+  std::string data = saved(aisdi::Vector<int>({ 1, 2, 3 }));
+  data[serialization::HEADER_SIZE + 1] ^= 1;
+  std::istringstream in(data);
+
+  BOOST_CHECK_THROW(serialization::loadVector<int>(in), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenTruncatedData_WhenLoading_ThenExceptionIsThrown)
+{
+  std::string data = saved(aisdi::Vector<int>({ 1, 2, 3 }));
+  std::istringstream in(data.substr(0, data.size() - 1));
+
+  BOOST_CHECK_THROW(serialization::loadVector<int>(in), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCorruptedCount_WhenLoading_ThenExceptionIsThrownBeforeAllocating)
+{
+  const std::string data = saved(aisdi::Vector<int>({ 1, 2, 3 }));
+  std::istringstream huge(withCount(data, std::uint64_t(1) << 40));
+  std::istringstream overflowing(withCount(data, ~std::uint64_t(0) / 2));
+
+  BOOST_CHECK_THROW(serialization::loadVector<int>(huge), std::runtime_error);
+  BOOST_CHECK_THROW(serialization::loadVector<int>(overflowing), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenStreamThatCannotSeek_WhenLoadingCorruptedCount_ThenExceptionIsThrown)
+{
+  ForwardOnlyBuffer buffer(withCount(saved(aisdi::Vector<int>({ 1, 2, 3 })), std::uint64_t(1) << 40));
+  std::istream in(&buffer);
+
+  BOOST_CHECK_THROW(serialization::loadVector<int>(in), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenStreamThatCannotSeek_WhenLoadingSeveralBlocks_ThenAllItemsAreRead)
+{
+  aisdi::Vector<int> vector;
+  for(int i = 0; i < 600000; ++i)
+    vector.append(i);
+  ForwardOnlyBuffer buffer(saved(vector));
+  std::istream in(&buffer);
+
+  const aisdi::Vector<int> loaded = serialization::loadVector<int>(in);
+
+  BOOST_REQUIRE_EQUAL(loaded.getSize(), vector.getSize());
+  BOOST_CHECK_EQUAL(loaded.data()[599999], 599999);
+}
+
+BOOST_AUTO_TEST_CASE(GivenOtherVersion_WhenLoading_ThenExceptionIsThrown)
+{
+  std::string data = saved(aisdi::Vector<int>({ 1, 2, 3 }));
+  data[8] = static_cast<char>(serialization::FORMAT_VERSION + 1);
+  std::istringstream in(data);
+
+  BOOST_CHECK_THROW(serialization::loadVector<int>(in), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSavedList_WhenLoadingAsVector_ThenExceptionIsThrown)
+{
+  std::istringstream in(saved(aisdi::LinkedList<int>({ 1, 2 })));
+
+  BOOST_CHECK_THROW(serialization::loadVector<int>(in), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSavedInts_WhenLoadingDoubles_ThenExceptionIsThrown)
+{
+  std::istringstream in(saved(aisdi::Vector<std::int32_t>({ 1, 2 })));
+
+  BOOST_CHECK_THROW(serialization::loadVector<double>(in), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSavedBuffer_WhenViewed_ThenSpanPointsIntoBuffer)
+{
+  const std::string data = saved(aisdi::Vector<int>({ 4, 5, 6 }));
+  aisdi::Vector<std::uint64_t> buffer;
+  buffer.resize((data.size() + 7) / 8);
+  data.copy(reinterpret_cast<char*>(buffer.data()), data.size());
+  const char* bytes = reinterpret_cast<const char*>(buffer.data());
+
+  const aisdi::Span<const int> view = serialization::view<int>(bytes, data.size());
+
+  BOOST_CHECK(reinterpret_cast<const char*>(view.data()) == bytes + serialization::HEADER_SIZE);
+  thenCollectionContainsValues(view, { 4, 5, 6 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenTooShortBuffer_WhenViewed_ThenExceptionIsThrown)
+{
+  const std::string data = saved(aisdi::Vector<int>({ 4, 5, 6 }));
+  aisdi::Vector<std::uint64_t> buffer;
+  buffer.resize((data.size() + 7) / 8);
+  data.copy(reinterpret_cast<char*>(buffer.data()), data.size());
+
+  BOOST_CHECK_THROW(serialization::view<int>(buffer.data(), data.size() - 4), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,174 @@
+#include <SharedVector.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using SharedCollection = aisdi::SharedVector<std::int32_t>;
+
+namespace
+{
+
+//Unique segment name, removed when the fixture goes out of scope
+struct TemporarySegment
+{
+  std::string name;
+
+  TemporarySegment()
+  {
+    static int counter = 0;
+    name = "/aisdi_shared_" + std::to_string(getpid()) + "_" + std::to_string(counter++);
+    SharedCollection::remove(name);
+  }
+
+  ~TemporarySegment()
+  {
+    SharedCollection::remove(name);
+  }
+};
+
+template <typename Collection>
+void thenCollectionContainsValues(const Collection& collection, std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(SharedVectorTests, TemporarySegment)
+
+BOOST_AUTO_TEST_CASE(GivenNewSegment_WhenOpenedByReader_ThenItIsEmpty)
+{
+  SharedCollection writer(name, SharedCollection::OpenMode::Create, 16);
+  const SharedCollection reader(name, SharedCollection::OpenMode::Open);
+
+  BOOST_CHECK(writer.isWriter());
+  BOOST_CHECK(!reader.isWriter());
+  BOOST_CHECK_EQUAL(reader.getVersion(), 0u);
+  BOOST_CHECK(reader.snapshot().isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenPublishedVector_WhenReaderTakesSnapshot_ThenItSeesSameItems)
+{
+  SharedCollection writer(name, SharedCollection::OpenMode::Create);
+  const SharedCollection reader(name, SharedCollection::OpenMode::Open);
+
+  writer.publish(aisdi::Vector<std::int32_t>({ 1, 2, 3 }));
+
+  BOOST_CHECK_EQUAL(reader.getVersion(), 1u);
+  BOOST_CHECK_EQUAL(reader.getSize(), 3u);
+  thenCollectionContainsValues(reader.snapshot(), { 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenMappedSegment_WhenCreatedAgain_ThenOldReaderKeepsLastPublication)
+{
+  SharedCollection writer(name, SharedCollection::OpenMode::Create);
+  writer.publish(aisdi::Vector<std::int32_t>({ 1, 2, 3 }));
+  const SharedCollection oldReader(name, SharedCollection::OpenMode::Open);
+
+  SharedCollection newWriter(name, SharedCollection::OpenMode::Create);
+  newWriter.publish(aisdi::Vector<std::int32_t>({ 4 }));
+  const SharedCollection newReader(name, SharedCollection::OpenMode::Open);
+
+  BOOST_CHECK_EQUAL(oldReader.getVersion(), 1u);
+  thenCollectionContainsValues(oldReader.snapshot(), { 1, 2, 3 });
+  thenCollectionContainsValues(newReader.snapshot(), { 4 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenPublicationLargerThanSegment_WhenReading_ThenReaderFollowsGrowth)
+{
+  SharedCollection writer(name, SharedCollection::OpenMode::Create, 2);
+  const SharedCollection reader(name, SharedCollection::OpenMode::Open);
+  aisdi::Vector<std::int32_t> values;
+  for(int i = 0; i < 10000; ++i)
+    values.append(i);
+
+  writer.publish(values);
+
+  std::int64_t sum = 0;
+  const std::uint64_t version = reader.read([&sum](const std::int32_t* items, std::size_t size)
+  {
+    sum = 0;
+    for(std::size_t i = 0; i < size; ++i)
+      sum += items[i];
+  });
+  BOOST_CHECK_EQUAL(version, 1u);
+  BOOST_CHECK_EQUAL(sum, 10000ll * 9999 / 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenReader_WhenPublishing_ThenExceptionIsThrown)
+{
+  SharedCollection writer(name, SharedCollection::OpenMode::Create);
+  SharedCollection reader(name, SharedCollection::OpenMode::Open);
+  const std::int32_t value = 1;
+
+  BOOST_CHECK_THROW(reader.publish(&value, 1), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenMissingSegment_WhenOpened_ThenExceptionIsThrown)
+{
+  BOOST_CHECK_THROW(SharedCollection(name, SharedCollection::OpenMode::Open), std::system_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSegmentOfOtherElementType_WhenOpened_ThenExceptionIsThrown)
+{
+  aisdi::SharedVector<double> writer(name, aisdi::SharedVector<double>::OpenMode::Create);
+
+  BOOST_CHECK_THROW(SharedCollection(name, SharedCollection::OpenMode::Open), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenChildProcess_WhenParentPublishes_ThenChildReadsConsistentVersions)
+{
+  const int publications = 200;
+  const int size = 4096;
+  SharedCollection writer(name, SharedCollection::OpenMode::Create, size);
+
+  const pid_t child = fork();
+  BOOST_REQUIRE(child >= 0);
+  if(child == 0)
+  {
+    //Every publication holds *size* copies of one number, so a torn read is easy to spot
+    int status = 0;
+    try
+    {
+      const SharedCollection reader(name, SharedCollection::OpenMode::Open);
+      std::uint64_t seen = 0;
+      while(seen < static_cast<std::uint64_t>(publications))
+      {
+        seen = reader.waitForVersion(seen);
+        const aisdi::Vector<std::int32_t> values = reader.snapshot();
+        for(std::int32_t item : values)
+          if(item != values.data()[0]) status = 1;
+        if(values.getSize() != static_cast<std::size_t>(size)) status = 2;
+      }
+    }
+    catch(...)
+    {
+      status = 3;
+    }
+    _exit(status);
+  }
+
+  aisdi::Vector<std::int32_t> values;
+  values.resize(size);
+  for(int version = 1; version <= publications; ++version)
+  {
+    for(int i = 0; i < size; ++i)
+      values.data()[i] = version;
+    writer.publish(values);
+  }
+
+  int status = -1;
+  BOOST_REQUIRE_EQUAL(waitpid(child, &status, 0), child);
+  BOOST_CHECK(WIFEXITED(status));
+  BOOST_CHECK_EQUAL(WEXITSTATUS(status), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
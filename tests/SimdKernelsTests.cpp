@@ -0,0 +1,153 @@
+#include <SimdKernels.h>
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+using VectorizedTypes = boost::mpl::list<std::int32_t, float, double>;
+
+BOOST_AUTO_TEST_SUITE(SimdKernelsTests)
+
+namespace
+{
+
+//Sizes around the register widths exercise both the SIMD body and the scalar tail
+const std::size_t SIZES[] = { 0, 1, 3, 4, 7, 8, 15, 16, 31, 32, 33, 63, 64, 65, 1000, 4099 };
+
+template <typename T>
+aisdi::Vector<T> makeValues(std::size_t size)
+{
+  aisdi::Vector<T> values;
+  values.resize(size);
+  std::uint32_t seed = 777;
+  for(std::size_t i = 0; i < size; ++i)
+  {
+    seed = seed * 1103515245u + 12345u;
+    values.data()[i] = static_cast<T>(static_cast<int>(seed >> 16) % 2001 - 1000);
+  }
+  return values;
+}
+
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenVectorsOfManySizes_WhenCounting_ThenResultMatchesScalarLoop,
+                              T,
+                              VectorizedTypes)
+{
+  for(std::size_t size : SIZES)
+  {
+    const aisdi::Vector<T> values = makeValues<T>(size);
+    for(int needle = -1000; needle <= 1000; needle += 250)
+      BOOST_CHECK_EQUAL(aisdi::simd::count(values, static_cast<T>(needle)),
+                        aisdi::simd::detail::scalarCount(values.data(), size, static_cast<T>(needle)));
+  }
+}
+
+#ifdef AISDI_SIMD_VECTOR_EXTENSIONS
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenLaneCountersFlushedOften_WhenCounting_ThenNoMatchIsLost,
+                              T,
+                              VectorizedTypes)
+{
+  aisdi::Vector<T> values;
+  values.resize(1003);
+  for(std::size_t i = 0; i < values.getSize(); ++i)
+    values.data()[i] = T(7);
+  for(std::size_t flushBlocks : { 1, 2, 3, 1000 })
+    BOOST_CHECK_EQUAL((aisdi::simd::detail::countKernel<T, 16>(values.data(), values.getSize(), T(7), flushBlocks)),
+                      1003u);
+}
+#endif
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenVectorsOfManySizes_WhenFinding_ThenFirstMatchIsReturned,
+                              T,
+                              VectorizedTypes)
+{
+  for(std::size_t size : SIZES)
+  {
+    const aisdi::Vector<T> values = makeValues<T>(size);
+    for(std::size_t i = 0; i < size; i += 1 + size / 10)
+    {
+      const T needle = values.data()[i];
+      const std::size_t expected = aisdi::simd::detail::scalarFind(values.data(), size, needle);
+      BOOST_CHECK(aisdi::simd::find(values, needle) == values.begin() + expected);
+      BOOST_CHECK(aisdi::simd::contains(values, needle));
+    }
+    BOOST_CHECK(aisdi::simd::find(values, static_cast<T>(5000)) == values.end());
+    BOOST_CHECK(!aisdi::simd::contains(values, static_cast<T>(5000)));
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenVectorsOfManySizes_WhenGettingMinAndMax_ThenResultsMatchScalarLoop,
+                              T,
+                              VectorizedTypes)
+{
+  for(std::size_t size : SIZES)
+  {
+    if(size == 0) continue;
+    const aisdi::Vector<T> values = makeValues<T>(size);
+    BOOST_CHECK_EQUAL(aisdi::simd::min(values), aisdi::simd::detail::scalarMin(values.data(), size));
+    BOOST_CHECK_EQUAL(aisdi::simd::max(values), aisdi::simd::detail::scalarMax(values.data(), size));
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenVectorsOfManySizes_WhenSumming_ThenResultMatchesScalarLoop,
+                              T,
+                              VectorizedTypes)
+{
+  using Sum = typename aisdi::simd::detail::SumType<T>::type;
+  for(std::size_t size : SIZES)
+  {
+    const aisdi::Vector<T> values = makeValues<T>(size);
+    //Small integers are summed exactly in every precision
+    BOOST_CHECK_EQUAL(aisdi::simd::sum(values), aisdi::simd::detail::scalarSum(values.data(), size, Sum()));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenLargeInt32Values_WhenSumming_ThenResultDoesNotOverflow)
+{
+  aisdi::Vector<std::int32_t> values;
+  values.resize(100);
+  for(std::size_t i = 0; i < 100; ++i)
+    values.data()[i] = 2000000000;
+
+  BOOST_CHECK_EQUAL(aisdi::simd::sum(values), 200000000000LL);
+}
+
+BOOST_AUTO_TEST_CASE(GivenFloatValues_WhenSumming_ThenResultIsCloseToScalarLoop)
+{
+  aisdi::Vector<double> values;
+  values.resize(10001);
+  for(std::size_t i = 0; i < values.getSize(); ++i)
+    values.data()[i] = 1.0 / (i + 1);
+
+  const double expected = aisdi::simd::detail::scalarSum(values.data(), values.getSize(), 0.0);
+  BOOST_CHECK_CLOSE(aisdi::simd::sum(values), expected, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(GivenOtherElementType_WhenUsingKernels_ThenScalarFallbackIsUsed)
+{
+  const aisdi::Vector<std::uint64_t> values = { 5, 3, 9, 3 };
+
+  BOOST_CHECK(aisdi::simd::find(values, std::uint64_t(3)) == values.begin() + 1);
+  BOOST_CHECK_EQUAL(aisdi::simd::count(values, std::uint64_t(3)), 2u);
+  BOOST_CHECK_EQUAL(aisdi::simd::min(values), 3u);
+  BOOST_CHECK_EQUAL(aisdi::simd::max(values), 9u);
+  BOOST_CHECK_EQUAL(aisdi::simd::sum(values), 20u);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyVector_WhenGettingMinOrMax_ThenOperationThrows)
+{
+  const aisdi::Vector<float> empty;
+
+  BOOST_CHECK_THROW(aisdi::simd::min(empty), std::logic_error);
+  BOOST_CHECK_THROW(aisdi::simd::max(empty), std::logic_error);
+  BOOST_CHECK_EQUAL(aisdi::simd::sum(empty), 0.0f);
+  BOOST_CHECK(aisdi::simd::find(empty, 1.0f) == empty.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
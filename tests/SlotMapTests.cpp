@@ -0,0 +1,122 @@
+#include <SlotMap.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using Slots = aisdi::SlotMap<std::string>;
+
+BOOST_AUTO_TEST_SUITE(SlotMapTests)
+
+BOOST_AUTO_TEST_CASE(GivenEmptySlotMap_WhenCreated_ThenNullHandleIsNotContained)
+{
+  const Slots slots;
+
+  BOOST_CHECK(slots.isEmpty());
+  BOOST_CHECK(!slots.contains(Slots::Handle()));
+  BOOST_CHECK(slots.find(Slots::Handle()) == nullptr);
+  BOOST_CHECK_THROW(slots[Slots::Handle()], std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenInsertedValues_WhenLookingUpByHandle_ThenValuesAreReturned)
+{
+  Slots slots;
+
+  const Slots::Handle first = slots.insert("first");
+  const Slots::Handle second = slots.insert("second");
+
+  BOOST_CHECK_EQUAL(slots.getSize(), 2);
+  BOOST_CHECK_EQUAL(slots[first], "first");
+  BOOST_CHECK_EQUAL(slots[second], "second");
+  BOOST_CHECK(first != second);
+}
+
+BOOST_AUTO_TEST_CASE(GivenErasedValue_WhenUsingItsHandle_ThenHandleIsRejected)
+{
+  Slots slots;
+  const Slots::Handle first = slots.insert("first");
+  slots.insert("second");
+
+  slots.erase(first);
+
+  BOOST_CHECK(!slots.contains(first));
+  BOOST_CHECK_THROW(slots[first], std::out_of_range);
+  BOOST_CHECK_THROW(slots.erase(first), std::out_of_range);
+  BOOST_CHECK_EQUAL(slots.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenReusedSlot_WhenUsingStaleHandle_ThenNewValueIsNotReached)
+{
+  Slots slots;
+  const Slots::Handle stale = slots.insert("old");
+  slots.erase(stale);
+
+  const Slots::Handle fresh = slots.insert("new");
+
+  BOOST_CHECK_EQUAL(fresh.index, stale.index);
+  BOOST_CHECK(fresh != stale);
+  BOOST_CHECK(!slots.contains(stale));
+  BOOST_CHECK_EQUAL(slots[fresh], "new");
+}
+
+BOOST_AUTO_TEST_CASE(GivenValueErasedFromTheMiddle_WhenIterating_ThenValuesStayDenseAndHandlesStayValid)
+{
+  Slots slots;
+  const Slots::Handle a = slots.insert("a");
+  const Slots::Handle b = slots.insert("b");
+  const Slots::Handle c = slots.insert("c");
+
+  slots.erase(a);
+  slots[c] += "!";
+
+  std::vector<std::string> visited(slots.begin(), slots.end());
+  BOOST_REQUIRE_EQUAL(visited.size(), 2);
+  BOOST_CHECK_EQUAL(visited[0], "c!");
+  BOOST_CHECK_EQUAL(visited[1], "b");
+  BOOST_CHECK_EQUAL(slots[b], "b");
+  BOOST_CHECK_EQUAL(slots[c], "c!");
+  BOOST_CHECK(slots.handleAt(0) == c);
+  BOOST_CHECK(slots.handleAt(1) == b);
+  BOOST_CHECK_THROW(slots.handleAt(2), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenManyInsertsAndErases_WhenComparedWithExpectedValues_ThenEveryLiveHandleResolves)
+{
+  aisdi::SlotMap<int> slots;
+  std::vector<aisdi::SlotMap<int>::Handle> live;
+  std::vector<int> expected;
+  std::vector<aisdi::SlotMap<int>::Handle> erased;
+  unsigned seed = 2016;
+  for(int step = 0; step < 10000; ++step)
+  {
+    seed = seed * 1103515245u + 12345u;
+    if((seed >> 8) % 3 == 0 && !live.empty())
+    {
+      const std::size_t victim = (seed >> 12) % live.size();
+      slots.erase(live[victim]);
+      erased.push_back(live[victim]);
+      live[victim] = live.back();
+      expected[victim] = expected.back();
+      live.pop_back();
+      expected.pop_back();
+    }
+    else
+    {
+      live.push_back(slots.insert(step));
+      expected.push_back(step);
+    }
+  }
+
+  BOOST_REQUIRE_EQUAL(slots.getSize(), live.size());
+  for(std::size_t i = 0; i < live.size(); ++i)
+    BOOST_CHECK_EQUAL(slots[live[i]], expected[i]);
+  for(const auto& handle : erased)
+    BOOST_CHECK(!slots.contains(handle));
+  for(std::size_t position = 0; position < slots.getSize(); ++position)
+    BOOST_CHECK_EQUAL(*slots.find(slots.handleAt(position)), slots.data()[position]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
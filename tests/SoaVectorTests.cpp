@@ -0,0 +1,126 @@
+#include <SoaVector.h>
+#include <SimdKernels.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using Rows = aisdi::SoaVector<int, double, std::string>;
+using Row = Rows::value_type;
+
+BOOST_AUTO_TEST_SUITE(SoaVectorTests)
+
+namespace
+{
+
+void thenColumnsContain(const Rows& rows, std::initializer_list<int> ids)
+{
+  BOOST_CHECK_EQUAL(rows.getSize(), ids.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(rows.column<0>().begin(), rows.column<0>().begin() + rows.getSize(),
+                                ids.begin(), ids.end());
+  BOOST_CHECK_EQUAL(rows.column<1>().getSize(), ids.size());
+  BOOST_CHECK_EQUAL(rows.column<2>().getSize(), ids.size());
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(GivenSoaVector_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  const Rows rows;
+
+  BOOST_CHECK(rows.isEmpty());
+  BOOST_CHECK(rows.begin() == rows.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenSoaVector_WhenAppendingFields_ThenEachColumnGetsItsField)
+{
+  Rows rows;
+
+  rows.append(1, 1.5, "one");
+  rows.append(Row(2, 2.5, "two"));
+
+  thenColumnsContain(rows, { 1, 2 });
+  BOOST_CHECK_EQUAL(rows.column<1>().data()[1], 2.5);
+  BOOST_CHECK_EQUAL(rows.column<2>().data()[0], "one");
+}
+
+BOOST_AUTO_TEST_CASE(GivenSoaVector_WhenInsertingInTheMiddle_ThenAllColumnsShift)
+{
+  Rows rows = { Row(1, 1.0, "a"), Row(3, 3.0, "c") };
+
+  rows.insert(rows.begin() + 1, Row(2, 2.0, "b"));
+  rows.prepend(Row(0, 0.0, ""));
+
+  thenColumnsContain(rows, { 0, 1, 2, 3 });
+  BOOST_CHECK(static_cast<Row>(rows[2]) == Row(2, 2.0, "b"));
+}
+
+BOOST_AUTO_TEST_CASE(GivenSoaVector_WhenErasing_ThenRowsAreRemovedFromAllColumns)
+{
+  Rows rows = { Row(1, 1.0, "a"), Row(2, 2.0, "b"), Row(3, 3.0, "c"), Row(4, 4.0, "d") };
+
+  rows.erase(rows.begin());
+  rows.erase(rows.begin() + 1, rows.end());
+
+  thenColumnsContain(rows, { 2 });
+  BOOST_CHECK_EQUAL(rows[0].get<2>(), "b");
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptySoaVector_WhenErasingOrPopping_ThenOperationThrows)
+{
+  Rows rows;
+
+  BOOST_CHECK_THROW(rows.erase(rows.begin()), std::out_of_range);
+  BOOST_CHECK_THROW(rows.popLast(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSoaVector_WhenPoppingLast_ThenWholeRowIsReturned)
+{
+  Rows rows = { Row(1, 1.0, "a"), Row(2, 2.0, "b") };
+
+  BOOST_CHECK(rows.popLast() == Row(2, 2.0, "b"));
+  thenColumnsContain(rows, { 1 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenProxyReference_WhenAssigning_ThenUnderlyingFieldsChange)
+{
+  Rows rows = { Row(1, 1.0, "a"), Row(2, 2.0, "b") };
+
+  rows[0].get<1>() = 10.0;
+  *(rows.begin() + 1) = Row(5, 5.0, "e");
+
+  BOOST_CHECK_EQUAL(rows.column<1>().data()[0], 10.0);
+  BOOST_CHECK(static_cast<Row>(rows[1]) == Row(5, 5.0, "e"));
+}
+
+BOOST_AUTO_TEST_CASE(GivenSoaVector_WhenIterating_ThenRowsAreVisitedInOrder)
+{
+  Rows rows = { Row(1, 1.0, "a"), Row(2, 2.0, "b"), Row(3, 3.0, "c") };
+
+  int expected = 1;
+  for(auto row : rows)
+    BOOST_CHECK_EQUAL(row.get<0>(), expected++);
+  BOOST_CHECK_THROW(*rows.end(), std::out_of_range);
+  BOOST_CHECK_THROW(++rows.end(), std::out_of_range);
+  BOOST_CHECK_THROW(--rows.begin(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSoaVector_WhenUsingColumnSpan_ThenFieldsCanBeScannedAndModified)
+{
+  aisdi::SoaVector<float, std::int32_t> rows;
+  for(int i = 0; i < 100; ++i)
+    rows.append(static_cast<float>(i), i);
+
+  for(float& value : rows.columnSpan<0>())
+    value *= 2;
+
+  BOOST_CHECK_EQUAL(aisdi::simd::sum(rows.column<1>()), 4950);
+  BOOST_CHECK_EQUAL(aisdi::simd::max(rows.column<0>()), 198.0f);
+  BOOST_CHECK_EQUAL(rows.columnSpan<1>().getSize(), 100u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
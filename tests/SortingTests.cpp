@@ -0,0 +1,175 @@
+#include <Sorting.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+template <typename Type>
+aisdi::Vector<Type> makeVector(const std::vector<Type>& items)
+{
+  aisdi::Vector<Type> vector;
+  for(const Type& item : items)
+    vector.append(item);
+  return vector;
+}
+
+template <typename Type>
+void thenVectorContainsValues(const aisdi::Vector<Type>& vector, const std::vector<Type>& expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(vector.begin(), vector.end(), expected.begin(), expected.end());
+}
+
+//Inputs which trip up naive quicksorts, followed by plain random ones
+std::vector<std::vector<int>> makeInputs(std::size_t size)
+{
+  std::vector<std::vector<int>> inputs;
+  std::vector<int> items(size);
+  for(std::size_t i = 0; i < size; ++i) items[i] = static_cast<int>(i);
+  inputs.push_back(items);
+  std::reverse(items.begin(), items.end());
+  inputs.push_back(items);
+  for(std::size_t i = 0; i < size; ++i) items[i] = static_cast<int>(i < size / 2 ? i : size - i);
+  inputs.push_back(items);
+  for(std::size_t i = 0; i < size; ++i) items[i] = static_cast<int>(i % 3);
+  inputs.push_back(items);
+  inputs.push_back(std::vector<int>(size, 7));
+
+  unsigned seed = 2016;
+  for(std::size_t i = 0; i < size; ++i)
+  {
+    seed = seed * 1103515245u + 12345u;
+    items[i] = static_cast<int>(seed >> 1) - (1 << 30);
+  }
+  inputs.push_back(items);
+  for(std::size_t i = 0; i < size; i += 97)
+    std::swap(items[i], items[size - 1 - i]);
+  std::sort(items.begin(), items.end() - size / 10);
+  inputs.push_back(items);
+  return inputs;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(SortingTests)
+
+BOOST_AUTO_TEST_CASE(GivenEmptyOrSingleElementVector_WhenSorting_ThenNothingChanges)
+{
+  aisdi::Vector<int> empty;
+  aisdi::Vector<int> single = { 42 };
+
+  aisdi::sort(empty);
+  aisdi::stableSort(empty, std::less<int>());
+  aisdi::sort(single, std::greater<int>());
+
+  BOOST_CHECK(empty.isEmpty());
+  thenVectorContainsValues(single, { 42 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenAdversarialInputs_WhenSortingWithComparator_ThenResultMatchesStdSort)
+{
+  for(std::size_t size : { 5u, 23u, 24u, 100u, 129u, 1000u, 20000u })
+    for(const std::vector<int>& input : makeInputs(size))
+    {
+      aisdi::Vector<int> vector = makeVector(input);
+      std::vector<int> expected = input;
+      std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+      aisdi::sort(vector, std::greater<int>());
+
+      BOOST_REQUIRE(std::equal(expected.begin(), expected.end(), vector.data()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(GivenIntegers_WhenSortingInDefaultOrder_ThenRadixSortMatchesStdSort)
+{
+  for(const std::vector<int>& input : makeInputs(5000))
+  {
+    aisdi::Vector<int> vector = makeVector(input);
+    std::vector<int> expected = input;
+    std::sort(expected.begin(), expected.end());
+
+    aisdi::sort(vector);
+
+    BOOST_REQUIRE(std::equal(expected.begin(), expected.end(), vector.data()));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenUnsignedAndNarrowIntegers_WhenSorting_ThenOrderIsAscending)
+{
+  aisdi::Vector<std::uint64_t> wide;
+  aisdi::Vector<signed char> narrow;
+  unsigned seed = 7;
+  for(int i = 0; i < 3000; ++i)
+  {
+    seed = seed * 1103515245u + 12345u;
+    wide.append(std::uint64_t(seed) << (seed % 33));
+    narrow.append(static_cast<signed char>(seed >> 16));
+  }
+
+  aisdi::sort(wide);
+  aisdi::stableSort(narrow);
+
+  BOOST_CHECK(std::is_sorted(wide.data(), wide.data() + wide.getSize()));
+  BOOST_CHECK(std::is_sorted(narrow.data(), narrow.data() + narrow.getSize()));
+}
+
+BOOST_AUTO_TEST_CASE(GivenFloatingPointNumbers_WhenSorting_ThenNegativeOnesComeFirst)
+{
+  aisdi::Vector<double> vector;
+  for(int i = 0; i < 2000; ++i)
+    vector.append((i % 2 ? -1.0 : 1.0) * (i % 37) / 7.0 + (i % 5) * 1e-3);
+  vector.append(-1e300);
+  vector.append(1e-300);
+  std::vector<double> expected(vector.data(), vector.data() + vector.getSize());
+  std::sort(expected.begin(), expected.end());
+
+  aisdi::sort(vector);
+
+  BOOST_CHECK(std::equal(expected.begin(), expected.end(), vector.data()));
+  BOOST_CHECK_EQUAL(vector.data()[0], -1e300);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEqualKeys_WhenStableSorting_ThenInsertionOrderIsKept)
+{
+  using Item = std::pair<int, int>;
+  for(std::size_t size : { 10u, 1000u })
+  {
+    aisdi::Vector<Item> byComparator;
+    for(std::size_t i = 0; i < size; ++i)
+      byComparator.append(Item(static_cast<int>((i * 7919) % 13) - 6, static_cast<int>(i)));
+    aisdi::Vector<Item> byKey = byComparator;
+    std::vector<Item> expected(byComparator.data(), byComparator.data() + size);
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const Item& a, const Item& b) { return a.first < b.first; });
+
+    aisdi::stableSort(byComparator, [](const Item& a, const Item& b) { return a.first < b.first; });
+    aisdi::stableSortByKey(byKey, [](const Item& item) { return item.first; });
+
+    BOOST_REQUIRE(std::equal(expected.begin(), expected.end(), byComparator.data()));
+    BOOST_REQUIRE(std::equal(expected.begin(), expected.end(), byKey.data()));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenKeyExtractor_WhenSortingByKey_ThenElementsAreOrderedByKey)
+{
+  aisdi::Vector<std::string> words = { "pear", "fig", "banana", "kiwi", "apple" };
+  aisdi::Vector<std::string> sortedWords = words;
+
+  aisdi::sortByKey(words, [](const std::string& word) { return word.size(); });
+  aisdi::sort(sortedWords);
+
+  BOOST_CHECK_EQUAL(*words.begin(), "fig");
+  BOOST_CHECK_EQUAL(*(words.end() - 1), "banana");
+  thenVectorContainsValues(sortedWords, { "apple", "banana", "fig", "kiwi", "pear" });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
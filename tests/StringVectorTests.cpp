@@ -0,0 +1,167 @@
+#include <StringVector.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using aisdi::Interning;
+using aisdi::StringVector;
+using aisdi::StringView;
+
+namespace
+{
+
+void thenStringsMatch(const StringVector& strings, const std::vector<std::string>& expected)
+{
+  BOOST_REQUIRE_EQUAL(strings.getSize(), expected.size());
+  std::size_t i = 0;
+  for(StringView item : strings)
+    BOOST_REQUIRE_EQUAL(item.toString(), expected[i++]);
+}
+
+std::string wordFor(unsigned seed)
+{
+  return std::string("word-") + std::to_string(seed % 97) + std::string(seed % 40, 'x');
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(StringVectorTests)
+
+BOOST_AUTO_TEST_CASE(GivenEmptyStrings_WhenPoppingOrAccessing_ThenExceptionIsThrown)
+{
+  StringVector strings;
+
+  BOOST_CHECK(strings.isEmpty());
+  BOOST_CHECK_THROW(strings.popFirst(), std::logic_error);
+  BOOST_CHECK_THROW(strings.popLast(), std::logic_error);
+  BOOST_CHECK_THROW(strings.at(0), std::out_of_range);
+  BOOST_CHECK_THROW(strings.erase(strings.begin()), std::out_of_range);
+  BOOST_CHECK_THROW(*strings.begin(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenStrings_WhenAppendingPrependingAndInserting_ThenOrderIsKept)
+{
+  StringVector strings = { "b", "" };
+
+  strings.append(std::string("a longer string than the small string buffer"));
+  strings.prepend("a");
+  strings.insert(strings.begin() + 2, "c");
+
+  thenStringsMatch(strings, { "a", "b", "c", "", "a longer string than the small string buffer" });
+  BOOST_CHECK(strings.at(3).isEmpty());
+  BOOST_CHECK_EQUAL(strings.popFirst(), "a");
+  BOOST_CHECK_EQUAL(strings.popLast(), "a longer string than the small string buffer");
+  thenStringsMatch(strings, { "b", "c", "" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenStrings_WhenErasingInvalidRange_ThenExceptionIsThrown)
+{
+  StringVector strings = { "a", "b", "c" };
+
+  BOOST_CHECK_THROW(strings.erase(strings.begin() + 2, strings.begin() + 1), std::out_of_range);
+  BOOST_CHECK_THROW(strings.erase(strings.begin(), strings.begin() + 4), std::out_of_range);
+  BOOST_CHECK_THROW(strings.insert(strings.begin() + 4, "d"), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenErasedStrings_WhenGarbageExceedsRatio_ThenArenaIsCompacted)
+{
+  StringVector strings;
+  for(int i = 0; i < 10; ++i)
+    strings.append("0123456789");
+
+  strings.erase(strings.begin());
+  BOOST_CHECK_EQUAL(strings.getArenaSize(), 100u);
+
+  strings.erase(strings.begin(), strings.begin() + 2);
+  BOOST_CHECK_EQUAL(strings.getArenaSize(), 70u);
+  BOOST_CHECK_EQUAL(strings.getSize(), 7u);
+  BOOST_CHECK_EQUAL(strings[6], StringView("0123456789"));
+}
+
+BOOST_AUTO_TEST_CASE(GivenInterning_WhenAppendingDuplicates_ThenCharactersAreStoredOnce)
+{
+  StringVector strings(Interning::Enabled);
+  for(int i = 0; i < 1000; ++i)
+    strings.append(i % 2 ? "TODO" : "DONE");
+
+  BOOST_CHECK_EQUAL(strings.getSize(), 1000u);
+  BOOST_CHECK_EQUAL(strings.getArenaSize(), 8u);
+  BOOST_CHECK_EQUAL(strings[0], StringView("DONE"));
+  BOOST_CHECK_EQUAL(strings[999], StringView("TODO"));
+}
+
+BOOST_AUTO_TEST_CASE(GivenInterning_WhenLastCopyIsErased_ThenItsCharactersAreCompactedAway)
+{
+  StringVector strings(Interning::Enabled);
+  for(int i = 0; i < 10; ++i)
+    strings.append("TODO");
+  strings.append("0123456789");
+  strings.append("0123456789");
+
+  strings.erase(strings.begin(), strings.begin() + 9);
+  strings.popLast();
+  BOOST_CHECK_EQUAL(strings.getArenaSize(), 14u);
+
+  strings.popLast();
+  BOOST_CHECK_EQUAL(strings.getArenaSize(), 4u);
+  thenStringsMatch(strings, { "TODO" });
+  strings.append("0123456789");
+  BOOST_CHECK_EQUAL(strings.getArenaSize(), 14u);
+}
+
+BOOST_AUTO_TEST_CASE(GivenStrings_WhenAppendingOwnElementsThroughReallocations_ThenCopiesAreIntact)
+{
+  for(Interning interning : { Interning::Disabled, Interning::Enabled })
+  {
+    StringVector strings(interning);
+    strings.append("a string longer than the small string buffer");
+    for(int i = 0; i < 100; ++i)
+    {
+      strings.append(strings[0]);
+      strings.prepend(strings[strings.getSize() - 1]);
+      strings.insert(strings.begin() + 1, strings[1]);
+    }
+
+    BOOST_REQUIRE_EQUAL(strings.getSize(), 301u);
+    for(StringView item : strings)
+      BOOST_REQUIRE_EQUAL(item, StringView("a string longer than the small string buffer"));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenRandomInsertsAndErases_WhenComparedWithStdVector_ThenStringsAreTheSame)
+{
+  for(Interning interning : { Interning::Disabled, Interning::Enabled })
+  {
+    StringVector strings(interning);
+    std::vector<std::string> expected;
+    unsigned seed = 2016;
+    for(int step = 0; step < 3000; ++step)
+    {
+      seed = seed * 1103515245u + 12345u;
+      const std::size_t position = expected.empty() ? 0 : (seed >> 8) % (expected.size() + 1);
+      if((seed >> 4) % 3 == 0 && position < expected.size())
+      {
+        const std::size_t last = std::min(expected.size(), position + (seed >> 20) % 20);
+        strings.erase(strings.begin() + position, strings.begin() + last);
+        expected.erase(expected.begin() + position, expected.begin() + last);
+      }
+      else
+      {
+        const std::string item = wordFor(seed >> 12);
+        strings.insert(strings.begin() + position, item);
+        expected.insert(expected.begin() + position, item);
+      }
+    }
+    thenStringsMatch(strings, expected);
+    strings.compact();
+    thenStringsMatch(strings, expected);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
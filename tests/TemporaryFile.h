@@ -0,0 +1,27 @@
+#ifndef AISDI_LINEAR_TESTS_TEMPORARYFILE_H
+#define AISDI_LINEAR_TESTS_TEMPORARYFILE_H
+
+#include <cstdio>
+#include <string>
+
+#include <unistd.h>
+
+//Unique file in the temporary directory, removed when the fixture goes out of scope
+struct TemporaryFile
+{
+  std::string path;
+
+  TemporaryFile()
+  {
+    static int counter = 0;
+    path = "/tmp/aisdi_test_" + std::to_string(getpid()) + "_" + std::to_string(counter++);
+    std::remove(path.c_str());
+  }
+
+  ~TemporaryFile()
+  {
+    std::remove(path.c_str());
+  }
+};
+
+#endif // AISDI_LINEAR_TESTS_TEMPORARYFILE_H
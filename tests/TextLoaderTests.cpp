@@ -0,0 +1,146 @@
+#include <TextLoader.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+template <typename Type>
+aisdi::Vector<Type> parsed(const std::string& text, std::size_t threads = 2)
+{
+  aisdi::ThreadPool pool(threads);
+  return aisdi::text::parseNumbers<Type>(text.data(), text.size(), pool);
+}
+
+template <typename Collection, typename Type>
+void thenCollectionContainsValues(const Collection& collection, std::initializer_list<Type> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(TextLoaderTests)
+
+BOOST_AUTO_TEST_CASE(GivenIntegerLines_WhenParsing_ThenAllNumbersAreReturned)
+{
+  thenCollectionContainsValues(parsed<int>("1\n-2\n+30\n  4 \r\n"), { 1, -2, 30, 4 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenBlankLinesAndNoFinalNewline_WhenParsing_ThenOnlyNumbersAreReturned)
+{
+  thenCollectionContainsValues(parsed<int>("\n\n5\n\n \n6"), { 5, 6 });
+  BOOST_CHECK(parsed<int>("").isEmpty());
+  BOOST_CHECK(parsed<int>("\n\n").isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenIntegerLimits_WhenParsing_ThenOverflowIsRejected)
+{
+  thenCollectionContainsValues(parsed<std::int32_t>("2147483647\n-2147483648\n"),
+                               { std::numeric_limits<std::int32_t>::max(), std::numeric_limits<std::int32_t>::min() });
+  BOOST_CHECK_THROW(parsed<std::int32_t>("2147483648\n"), std::runtime_error);
+  BOOST_CHECK_THROW(parsed<std::uint32_t>("-1\n"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenOverflowingInteger_WhenParsing_ThenErrorPointsAtTokenStart)
+{
+  try
+  {
+    parsed<std::int32_t>("1\n99999999999\n");
+    BOOST_FAIL("Overflow was not rejected");
+  }
+  catch(const std::runtime_error& e)
+  {
+    BOOST_CHECK_EQUAL(std::string(e.what()), "Cannot parse number at byte 2");
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenDoubleLines_WhenParsing_ThenValuesMatchStrtod)
+{
+  const char* lines[] = { "0.1", "-2.5e3", "3", "1e-5", ".5", "6.02214076e23", "123456789012345678901234",
+                          "4.9406564584124654e-324", "1.7976931348623157e308", "2.2250738585072014e-308" };
+  std::string text;
+  for(const char* line : lines)
+    text += std::string(line) + "\n";
+
+  const aisdi::Vector<double> values = parsed<double>(text);
+
+  BOOST_REQUIRE_EQUAL(values.getSize(), sizeof(lines) / sizeof(lines[0]));
+  for(std::size_t i = 0; i < values.getSize(); ++i)
+    BOOST_CHECK_EQUAL(values.data()[i], std::strtod(lines[i], nullptr));
+}
+
+BOOST_AUTO_TEST_CASE(GivenFloatLines_WhenParsing_ThenValuesMatchStrtofWithoutDoubleRounding)
+{
+  //Rounding these to double first lands exactly halfway between two floats
+  const char* lines[] = { "1.000000536441803", "1.0000000596046448", "1.0000001788139343", "0.1", "-2.5e3",
+                          "16777217", "3.4028235e38", "1e-45", "7e-3", "123456.7" };
+  std::string text;
+  for(const char* line : lines)
+    text += std::string(line) + "\n";
+
+  const aisdi::Vector<float> values = parsed<float>(text);
+
+  BOOST_REQUIRE_EQUAL(values.getSize(), sizeof(lines) / sizeof(lines[0]));
+  for(std::size_t i = 0; i < values.getSize(); ++i)
+    BOOST_CHECK_EQUAL(values.data()[i], std::strtof(lines[i], nullptr));
+}
+
+BOOST_AUTO_TEST_CASE(GivenHexadecimalFloats_WhenParsing_ThenValuesMatchStandardLibrary)
+{
+  thenCollectionContainsValues(parsed<double>("0x1p3\n-0X1.8p1\n0x10\n"), { 8.0, -3.0, 16.0 });
+  thenCollectionContainsValues(parsed<float>("0x1p-2\n"), { 0.25f });
+}
+
+BOOST_AUTO_TEST_CASE(GivenMalformedLine_WhenParsing_ThenExceptionIsThrown)
+{
+  BOOST_CHECK_THROW(parsed<double>("1.0\nabc\n"), std::runtime_error);
+  BOOST_CHECK_THROW(parsed<int>("1 2\n"), std::runtime_error);
+  BOOST_CHECK_THROW(parsed<int>("1.5\n"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenTextSpanningManyChunks_WhenParsingInParallel_ThenOrderIsKept)
+{
+  std::ostringstream text;
+  for(int i = 0; i < 300000; ++i)
+  {
+    text << i << '\n';
+    if(i % 1000 == 0) text << '\n';
+  }
+
+  for(std::size_t threads = 1; threads <= 3; ++threads)
+  {
+    const aisdi::Vector<int> values = parsed<int>(text.str(), threads);
+    BOOST_REQUIRE_EQUAL(values.getSize(), 300000u);
+    bool ordered = true;
+    for(int i = 0; i < 300000; ++i)
+      ordered = ordered && values.data()[i] == i;
+    BOOST_CHECK(ordered);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenFile_WhenLoading_ThenNumbersAreReadThroughMapping)
+{
+  const std::string path = "/tmp/aisdi_numbers_" + std::to_string(getpid());
+  {
+    std::ofstream file(path);
+    file << "1.5\n2.25\n-3\n";
+  }
+
+  thenCollectionContainsValues(aisdi::text::loadNumbers<double>(path), { 1.5, 2.25, -3.0 });
+  std::remove(path.c_str());
+  BOOST_CHECK_THROW(aisdi::text::loadNumbers<double>(path), std::system_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,154 @@
+#include <TombstoneVector.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using LazyCollection = aisdi::TombstoneVector<int>;
+
+namespace
+{
+
+template <typename Collection>
+void thenCollectionContainsValues(const Collection& collection, std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(TombstoneVectorTests)
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenErasingFromTheMiddle_ThenIterationSkipsErasedItems)
+{
+  LazyCollection collection(1.0);
+  for(int i = 1; i <= 5; ++i)
+    collection.append(i);
+
+  collection.erase(collection.begin() + 1);
+  collection.erase(collection.begin() + 2);
+
+  thenCollectionContainsValues(collection, { 1, 3, 5 });
+  BOOST_CHECK_EQUAL(collection.getSize(), 3);
+  BOOST_CHECK_EQUAL(collection.getErasedCount(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenErasedItems_WhenIteratingBackwards_ThenErasedItemsAreSkipped)
+{
+  LazyCollection collection(1.0);
+  for(int i = 1; i <= 5; ++i)
+    collection.append(i);
+  collection.erase(collection.begin());
+  collection.erase(collection.end() - 1);
+
+  auto it = collection.end();
+
+  BOOST_CHECK_EQUAL(*--it, 4);
+  BOOST_CHECK_EQUAL(*--it, 3);
+  BOOST_CHECK_EQUAL(*--it, 2);
+  BOOST_CHECK(it == collection.begin());
+  BOOST_CHECK_THROW(--it, std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenErasedItem_WhenErasingItAgain_ThenExceptionIsThrown)
+{
+  LazyCollection collection(1.0);
+  collection.append(1);
+  collection.append(2);
+  auto first = collection.begin();
+  collection.erase(first);
+
+  BOOST_CHECK_THROW(collection.erase(first), std::out_of_range);
+  BOOST_CHECK_THROW(collection.erase(collection.end()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRatioThreshold_WhenTooManyItemsAreErased_ThenCollectionIsCompacted)
+{
+  LazyCollection collection(0.25);
+  for(int i = 0; i < 8; ++i)
+    collection.append(i);
+
+  collection.erase(collection.begin());
+  collection.erase(collection.begin());
+  BOOST_CHECK_EQUAL(collection.getErasedCount(), 2);
+  collection.erase(collection.begin());
+
+  BOOST_CHECK_EQUAL(collection.getErasedCount(), 0);
+  thenCollectionContainsValues(collection, { 3, 4, 5, 6, 7 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenTombstones_WhenErasingIf_ThenTombstonesAndMatchesAreRemovedInOnePass)
+{
+  LazyCollection collection(1.0);
+  for(int i = 0; i < 10; ++i)
+    collection.append(i);
+  collection.erase(collection.begin() + 2);
+
+  const std::size_t removed = collection.eraseIf([](int item) { return item % 3 == 0; });
+
+  BOOST_CHECK_EQUAL(removed, 4);
+  BOOST_CHECK_EQUAL(collection.getErasedCount(), 0);
+  thenCollectionContainsValues(collection, { 1, 4, 5, 7, 8 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenErasedRange_WhenCompacting_ThenOnlyLiveItemsRemain)
+{
+  LazyCollection collection = { 1, 2, 3, 4, 5, 6 };
+  collection.setCompactionRatio(1.0);
+
+  collection.erase(collection.begin() + 1, collection.begin() + 4);
+  BOOST_CHECK_EQUAL(collection.getErasedCount(), 3);
+  collection.compact();
+
+  BOOST_CHECK_EQUAL(collection.getErasedCount(), 0);
+  thenCollectionContainsValues(collection, { 1, 5, 6 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenTrailingTombstones_WhenPoppingAndAppending_ThenNewItemsAreLive)
+{
+  LazyCollection collection(1.0);
+  for(int i = 0; i < 70; ++i)
+    collection.append(i);
+  collection.erase(collection.begin() + 69);
+  collection.erase(collection.begin() + 66);
+
+  BOOST_CHECK_EQUAL(collection.popLast(), 68);
+  collection.append(100);
+  collection.append(101);
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 69);
+  BOOST_CHECK_EQUAL(collection.getErasedCount(), 1);
+  BOOST_CHECK_EQUAL(*(collection.end() - 1), 101);
+  BOOST_CHECK_EQUAL(*(collection.end() - 3), 67);
+  BOOST_CHECK_EQUAL(*(collection.end() - 4), 65);
+}
+
+BOOST_AUTO_TEST_CASE(GivenScatteredErases_WhenComparedWithVector_ThenContentsAreEqual)
+{
+  LazyCollection collection;
+  std::vector<int> expected;
+  for(int i = 0; i < 5000; ++i)
+  {
+    collection.append(i);
+    expected.push_back(i);
+  }
+
+  unsigned seed = 2016;
+  for(int step = 0; step < 4000; ++step)
+  {
+    seed = seed * 1103515245u + 12345u;
+    const std::size_t position = (seed >> 8) % expected.size();
+    collection.erase(collection.begin() + position);
+    expected.erase(expected.begin() + position);
+  }
+
+  BOOST_REQUIRE_EQUAL(collection.getSize(), expected.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+  std::vector<int> visited;
+  collection.forEach([&visited](int item) { visited.push_back(item); });
+  BOOST_CHECK_EQUAL_COLLECTIONS(visited.begin(), visited.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,133 @@
+#include <VectorBatch.h>
+
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using Collection = aisdi::Vector<int>;
+using Batch = aisdi::VectorBatch<int>;
+
+namespace
+{
+
+void thenCollectionContainsValues(const Collection& collection, std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+//Apply the same random operations one by one and as a batch
+void checkAgainstSequential(std::size_t size, std::size_t operations, std::size_t spareCapacity, unsigned seed)
+{
+  Collection expected;
+  for(std::size_t i = 0; i < size; ++i)
+    expected.append(static_cast<int>(i));
+  Collection collection = expected;
+  collection.reserve(size + spareCapacity);
+
+  Batch batch;
+  std::size_t currentSize = size;
+  for(std::size_t i = 0; i < operations; ++i)
+  {
+    seed = seed * 1103515245u + 12345u;
+    if((seed >> 4) % 3 == 0 && currentSize > 0)
+    {
+      const std::size_t position = (seed >> 8) % currentSize;
+      batch.erase(position);
+      expected.erase(expected.begin() + position);
+      --currentSize;
+    }
+    else
+    {
+      const std::size_t position = (seed >> 8) % (currentSize + 1);
+      batch.insert(position, -static_cast<int>(i) - 1);
+      expected.insert(expected.begin() + position, -static_cast<int>(i) - 1);
+      ++currentSize;
+    }
+  }
+
+  batch.applyTo(collection);
+
+  BOOST_REQUIRE_EQUAL(collection.getSize(), expected.getSize());
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.begin(), collection.end(), expected.begin(), expected.end());
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(VectorBatchTests)
+
+BOOST_AUTO_TEST_CASE(GivenEmptyBatch_WhenApplied_ThenCollectionIsUnchanged)
+{
+  Collection collection = { 1, 2, 3 };
+  const Batch batch;
+
+  batch.applyTo(collection);
+
+  BOOST_CHECK(batch.isEmpty());
+  thenCollectionContainsValues(collection, { 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenOperationsReferringToEarlierOnes_WhenApplied_ThenResultMatchesSequentialOrder)
+{
+  Collection collection = { 10, 20, 30 };
+  Batch batch;
+
+  batch.insert(1, 15);
+  batch.insert(1, 12);
+  batch.erase(3);
+  batch.insert(4, 40);
+  batch.erase(0);
+
+  batch.applyTo(collection);
+
+  BOOST_CHECK_EQUAL(batch.getSize(), 5);
+  thenCollectionContainsValues(collection, { 12, 15, 30, 40 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenInsertThenEraseOfTheSameItem_WhenApplied_ThenItemIsNotPresent)
+{
+  Collection collection = { 1, 2 };
+  Batch batch;
+
+  batch.insert(1, 100);
+  batch.erase(1);
+
+  batch.applyTo(collection);
+
+  thenCollectionContainsValues(collection, { 1, 2 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenInvalidPosition_WhenApplied_ThenExceptionIsThrownAndCollectionIsUntouched)
+{
+  Collection collection = { 1, 2, 3 };
+  Batch batch;
+
+  batch.erase(0);
+  batch.insert(3, 4);
+
+  BOOST_CHECK_THROW(batch.applyTo(collection), std::out_of_range);
+  thenCollectionContainsValues(collection, { 1, 2, 3 });
+
+  batch.clear();
+  batch.erase(3);
+  BOOST_CHECK_THROW(batch.applyTo(collection), std::out_of_range);
+  thenCollectionContainsValues(collection, { 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenBatchThatOutgrowsCapacity_WhenApplied_ThenResultMatchesSequentialOrder)
+{
+  checkAgainstSequential(1000, 300, 0, 2016);
+}
+
+BOOST_AUTO_TEST_CASE(GivenBatchThatFitsInCapacity_WhenApplied_ThenResultMatchesSequentialOrder)
+{
+  checkAgainstSequential(1000, 300, 1000, 7);
+  checkAgainstSequential(50, 200, 500, 11);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenApplyingBatch_ThenResultMatchesSequentialOrder)
+{
+  checkAgainstSequential(0, 100, 0, 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,161 @@
+#include <VectorExpressions.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+using TestedTypes = boost::mpl::list<std::int32_t, double>;
+
+BOOST_AUTO_TEST_SUITE(VectorExpressionsTests)
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenVectors_WhenAssigningLinearCombination_ThenEachElementIsComputed,
+                              T,
+                              TestedTypes)
+{
+  const aisdi::Vector<T> x = { 1, 2, 3, 4 };
+  const aisdi::Vector<T> b = { 10, 20, 30, 40 };
+  const aisdi::Vector<T> c = { 1, 1, 1, 1 };
+
+  aisdi::Vector<T> result = 2 * x + b - c;
+
+  const aisdi::Vector<T> expected = { 11, 23, 35, 47 };
+  BOOST_CHECK_EQUAL_COLLECTIONS(result.begin(), result.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenExistingVector_WhenAssigningExpression_ThenStorageIsReused)
+{
+  const aisdi::Vector<double> x = { 1.0, 2.0, 3.0 };
+  aisdi::Vector<double> y = { 0.0, 0.0, 0.0 };
+  const double* storage = y.data();
+
+  aisdi::assign(y, x * x / 2.0);
+
+  BOOST_CHECK(y.data() == storage);
+  BOOST_CHECK_EQUAL(y.data()[2], 4.5);
+}
+
+BOOST_AUTO_TEST_CASE(GivenExistingVector_WhenAssigningExpressionWithOperator_ThenStorageIsReused)
+{
+  const aisdi::Vector<double> a = { 1.0, 2.0, 3.0 };
+  const aisdi::Vector<double> b = { 2.0, 2.0, 2.0 };
+  const aisdi::Vector<double> c = { 0.5, 1.0, 1.5 };
+  aisdi::Vector<double> r = { 0.0, 0.0, 0.0 };
+  aisdi::BitVector flags = { false, false, false };
+  const double* storage = r.data();
+  const aisdi::BitVector::word_type* words = flags.getWords();
+
+  r = a + b * c;
+  r = r * 2.0 - a;
+  flags = r > 4.0;
+
+  const aisdi::Vector<double> expected = { 3.0, 6.0, 9.0 };
+  BOOST_CHECK(r.data() == storage);
+  BOOST_CHECK_EQUAL_COLLECTIONS(r.begin(), r.end(), expected.begin(), expected.end());
+  BOOST_CHECK(flags.getWords() == words);
+  BOOST_CHECK_EQUAL(flags.count(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(GivenVectorInItsOwnExpression_WhenAssigning_ThenOldValuesAreUsed)
+{
+  aisdi::Vector<double> y = { 1.0, 2.0, 3.0 };
+  const aisdi::Vector<double> x = { 1.0, 1.0, 1.0 };
+
+  aisdi::assign(y, -y * 3.0 + x);
+
+  const aisdi::Vector<double> expected = { -2.0, -5.0, -8.0 };
+  BOOST_CHECK_EQUAL_COLLECTIONS(y.begin(), y.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenExpression_WhenAssignedWithOperator_ThenVectorHoldsResult)
+{
+  const aisdi::Vector<int> a = { 5, 6 };
+  aisdi::Vector<int> b = { 1, 2, 3 };
+
+  b = a - 1;
+
+  BOOST_CHECK_EQUAL(b.getSize(), 2u);
+  BOOST_CHECK_EQUAL(b.data()[0], 4);
+  BOOST_CHECK_EQUAL(b.data()[1], 5);
+}
+
+BOOST_AUTO_TEST_CASE(GivenVectorsOfDifferentSizes_WhenCombining_ThenOperationThrows)
+{
+  const aisdi::Vector<double> a = { 1.0, 2.0 };
+  const aisdi::Vector<double> b = { 1.0, 2.0, 3.0 };
+
+  BOOST_CHECK_THROW(a + b, std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyVector_WhenCombiningWithNonEmptyOne_ThenOperationThrows)
+{
+  const aisdi::Vector<int> empty;
+  const aisdi::Vector<int> b = { 1, 2, 3 };
+
+  BOOST_CHECK_THROW(empty + b, std::logic_error);
+  BOOST_CHECK_THROW(b * empty, std::logic_error);
+  BOOST_CHECK_THROW(b + (empty - 1), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyVector_WhenCombiningWithScalar_ThenResultIsEmpty)
+{
+  const aisdi::Vector<int> empty;
+
+  const aisdi::Vector<int> sum = empty + 2;
+  const aisdi::Vector<int> product = 3 * empty;
+
+  BOOST_CHECK(sum.isEmpty());
+  BOOST_CHECK(product.isEmpty());
+  BOOST_CHECK_EQUAL(aisdi::sum(empty + empty), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenVectors_WhenComparing_ThenBoolVectorIsProduced)
+{
+  const aisdi::Vector<double> x = { 0.1, 0.7, 0.5, 0.9 };
+  const aisdi::Vector<double> limit = { 0.5, 0.5, 0.5, 0.5 };
+
+  aisdi::Vector<bool> above = x > limit;
+  aisdi::BitVector same = aisdi::equal(x, 0.5);
+
+  const bool expectedAbove[] = { false, true, false, true };
+  const bool expectedSame[] = { false, false, true, false };
+  BOOST_CHECK_EQUAL_COLLECTIONS(above.begin(), above.end(), expectedAbove, expectedAbove + 4);
+  BOOST_CHECK_EQUAL_COLLECTIONS(same.begin(), same.end(), expectedSame, expectedSame + 4);
+  BOOST_CHECK_EQUAL(aisdi::countTrue(x <= 0.5), 2u);
+  BOOST_CHECK(aisdi::any(aisdi::notEqual(x, limit)));
+  BOOST_CHECK(!aisdi::all(x >= 0.5));
+  BOOST_CHECK_EQUAL(aisdi::countTrue(aisdi::notEqual(above, same)), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(GivenExpression_WhenReducing_ThenNoVectorIsNeeded)
+{
+  const aisdi::Vector<double> x = { 1.0, -2.0, 3.0 };
+  const aisdi::Vector<double> y = { 2.0, 2.0, 2.0 };
+
+  BOOST_CHECK_EQUAL(aisdi::sum(x * y), 4.0);
+  BOOST_CHECK_EQUAL(aisdi::min(x - y), -4.0);
+  BOOST_CHECK_EQUAL(aisdi::max(x + y), 5.0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyExpression_WhenGettingMinimum_ThenOperationThrows)
+{
+  const aisdi::Vector<double> empty;
+
+  BOOST_CHECK_THROW(aisdi::min(empty * 2.0), std::logic_error);
+  BOOST_CHECK_EQUAL(aisdi::sum(empty + 1.0), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonArithmeticVector_WhenUsingIteratorArithmetic_ThenItIsNotAffected)
+{
+  aisdi::Vector<std::string> words = { "a", "b", "c" };
+
+  auto it = words.end() - 1;
+
+  BOOST_CHECK_EQUAL(*it, "c");
+}
+
+BOOST_AUTO_TEST_SUITE_END()